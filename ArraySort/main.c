@@ -0,0 +1,1379 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <math.h>
+#include <time.h>
+#include <intrin.h>
+
+// ̗vfȉ͈̔͂́AWX^̃\[eBOlbg[NŕבւB
+#define SORT_NETWORK_LENGTH 16
+
+// ̂ƂɁA8 ̗vf̂s{bgȉ̗vfOɁAcɕׂ鏇ԁB
+// partition_permutation[mask] ́As{bg傫vf̃rbg mask ̂Ƃ̏ԁB
+// mask  0 ̃rbg̈ʒuɕׁA 1 ̃rbg̈ʒuɕׂ́B
+// Ȃ\Ȃ̂ŁÃXbh瓯ɎgĂ悢B
+const int partition_permutation[256][8] =
+{
+	{ 0, 1, 2, 3, 4, 5, 6, 7 },
+	{ 1, 2, 3, 4, 5, 6, 7, 0 },
+	{ 0, 2, 3, 4, 5, 6, 7, 1 },
+	{ 2, 3, 4, 5, 6, 7, 0, 1 },
+	{ 0, 1, 3, 4, 5, 6, 7, 2 },
+	{ 1, 3, 4, 5, 6, 7, 0, 2 },
+	{ 0, 3, 4, 5, 6, 7, 1, 2 },
+	{ 3, 4, 5, 6, 7, 0, 1, 2 },
+	{ 0, 1, 2, 4, 5, 6, 7, 3 },
+	{ 1, 2, 4, 5, 6, 7, 0, 3 },
+	{ 0, 2, 4, 5, 6, 7, 1, 3 },
+	{ 2, 4, 5, 6, 7, 0, 1, 3 },
+	{ 0, 1, 4, 5, 6, 7, 2, 3 },
+	{ 1, 4, 5, 6, 7, 0, 2, 3 },
+	{ 0, 4, 5, 6, 7, 1, 2, 3 },
+	{ 4, 5, 6, 7, 0, 1, 2, 3 },
+	{ 0, 1, 2, 3, 5, 6, 7, 4 },
+	{ 1, 2, 3, 5, 6, 7, 0, 4 },
+	{ 0, 2, 3, 5, 6, 7, 1, 4 },
+	{ 2, 3, 5, 6, 7, 0, 1, 4 },
+	{ 0, 1, 3, 5, 6, 7, 2, 4 },
+	{ 1, 3, 5, 6, 7, 0, 2, 4 },
+	{ 0, 3, 5, 6, 7, 1, 2, 4 },
+	{ 3, 5, 6, 7, 0, 1, 2, 4 },
+	{ 0, 1, 2, 5, 6, 7, 3, 4 },
+	{ 1, 2, 5, 6, 7, 0, 3, 4 },
+	{ 0, 2, 5, 6, 7, 1, 3, 4 },
+	{ 2, 5, 6, 7, 0, 1, 3, 4 },
+	{ 0, 1, 5, 6, 7, 2, 3, 4 },
+	{ 1, 5, 6, 7, 0, 2, 3, 4 },
+	{ 0, 5, 6, 7, 1, 2, 3, 4 },
+	{ 5, 6, 7, 0, 1, 2, 3, 4 },
+	{ 0, 1, 2, 3, 4, 6, 7, 5 },
+	{ 1, 2, 3, 4, 6, 7, 0, 5 },
+	{ 0, 2, 3, 4, 6, 7, 1, 5 },
+	{ 2, 3, 4, 6, 7, 0, 1, 5 },
+	{ 0, 1, 3, 4, 6, 7, 2, 5 },
+	{ 1, 3, 4, 6, 7, 0, 2, 5 },
+	{ 0, 3, 4, 6, 7, 1, 2, 5 },
+	{ 3, 4, 6, 7, 0, 1, 2, 5 },
+	{ 0, 1, 2, 4, 6, 7, 3, 5 },
+	{ 1, 2, 4, 6, 7, 0, 3, 5 },
+	{ 0, 2, 4, 6, 7, 1, 3, 5 },
+	{ 2, 4, 6, 7, 0, 1, 3, 5 },
+	{ 0, 1, 4, 6, 7, 2, 3, 5 },
+	{ 1, 4, 6, 7, 0, 2, 3, 5 },
+	{ 0, 4, 6, 7, 1, 2, 3, 5 },
+	{ 4, 6, 7, 0, 1, 2, 3, 5 },
+	{ 0, 1, 2, 3, 6, 7, 4, 5 },
+	{ 1, 2, 3, 6, 7, 0, 4, 5 },
+	{ 0, 2, 3, 6, 7, 1, 4, 5 },
+	{ 2, 3, 6, 7, 0, 1, 4, 5 },
+	{ 0, 1, 3, 6, 7, 2, 4, 5 },
+	{ 1, 3, 6, 7, 0, 2, 4, 5 },
+	{ 0, 3, 6, 7, 1, 2, 4, 5 },
+	{ 3, 6, 7, 0, 1, 2, 4, 5 },
+	{ 0, 1, 2, 6, 7, 3, 4, 5 },
+	{ 1, 2, 6, 7, 0, 3, 4, 5 },
+	{ 0, 2, 6, 7, 1, 3, 4, 5 },
+	{ 2, 6, 7, 0, 1, 3, 4, 5 },
+	{ 0, 1, 6, 7, 2, 3, 4, 5 },
+	{ 1, 6, 7, 0, 2, 3, 4, 5 },
+	{ 0, 6, 7, 1, 2, 3, 4, 5 },
+	{ 6, 7, 0, 1, 2, 3, 4, 5 },
+	{ 0, 1, 2, 3, 4, 5, 7, 6 },
+	{ 1, 2, 3, 4, 5, 7, 0, 6 },
+	{ 0, 2, 3, 4, 5, 7, 1, 6 },
+	{ 2, 3, 4, 5, 7, 0, 1, 6 },
+	{ 0, 1, 3, 4, 5, 7, 2, 6 },
+	{ 1, 3, 4, 5, 7, 0, 2, 6 },
+	{ 0, 3, 4, 5, 7, 1, 2, 6 },
+	{ 3, 4, 5, 7, 0, 1, 2, 6 },
+	{ 0, 1, 2, 4, 5, 7, 3, 6 },
+	{ 1, 2, 4, 5, 7, 0, 3, 6 },
+	{ 0, 2, 4, 5, 7, 1, 3, 6 },
+	{ 2, 4, 5, 7, 0, 1, 3, 6 },
+	{ 0, 1, 4, 5, 7, 2, 3, 6 },
+	{ 1, 4, 5, 7, 0, 2, 3, 6 },
+	{ 0, 4, 5, 7, 1, 2, 3, 6 },
+	{ 4, 5, 7, 0, 1, 2, 3, 6 },
+	{ 0, 1, 2, 3, 5, 7, 4, 6 },
+	{ 1, 2, 3, 5, 7, 0, 4, 6 },
+	{ 0, 2, 3, 5, 7, 1, 4, 6 },
+	{ 2, 3, 5, 7, 0, 1, 4, 6 },
+	{ 0, 1, 3, 5, 7, 2, 4, 6 },
+	{ 1, 3, 5, 7, 0, 2, 4, 6 },
+	{ 0, 3, 5, 7, 1, 2, 4, 6 },
+	{ 3, 5, 7, 0, 1, 2, 4, 6 },
+	{ 0, 1, 2, 5, 7, 3, 4, 6 },
+	{ 1, 2, 5, 7, 0, 3, 4, 6 },
+	{ 0, 2, 5, 7, 1, 3, 4, 6 },
+	{ 2, 5, 7, 0, 1, 3, 4, 6 },
+	{ 0, 1, 5, 7, 2, 3, 4, 6 },
+	{ 1, 5, 7, 0, 2, 3, 4, 6 },
+	{ 0, 5, 7, 1, 2, 3, 4, 6 },
+	{ 5, 7, 0, 1, 2, 3, 4, 6 },
+	{ 0, 1, 2, 3, 4, 7, 5, 6 },
+	{ 1, 2, 3, 4, 7, 0, 5, 6 },
+	{ 0, 2, 3, 4, 7, 1, 5, 6 },
+	{ 2, 3, 4, 7, 0, 1, 5, 6 },
+	{ 0, 1, 3, 4, 7, 2, 5, 6 },
+	{ 1, 3, 4, 7, 0, 2, 5, 6 },
+	{ 0, 3, 4, 7, 1, 2, 5, 6 },
+	{ 3, 4, 7, 0, 1, 2, 5, 6 },
+	{ 0, 1, 2, 4, 7, 3, 5, 6 },
+	{ 1, 2, 4, 7, 0, 3, 5, 6 },
+	{ 0, 2, 4, 7, 1, 3, 5, 6 },
+	{ 2, 4, 7, 0, 1, 3, 5, 6 },
+	{ 0, 1, 4, 7, 2, 3, 5, 6 },
+	{ 1, 4, 7, 0, 2, 3, 5, 6 },
+	{ 0, 4, 7, 1, 2, 3, 5, 6 },
+	{ 4, 7, 0, 1, 2, 3, 5, 6 },
+	{ 0, 1, 2, 3, 7, 4, 5, 6 },
+	{ 1, 2, 3, 7, 0, 4, 5, 6 },
+	{ 0, 2, 3, 7, 1, 4, 5, 6 },
+	{ 2, 3, 7, 0, 1, 4, 5, 6 },
+	{ 0, 1, 3, 7, 2, 4, 5, 6 },
+	{ 1, 3, 7, 0, 2, 4, 5, 6 },
+	{ 0, 3, 7, 1, 2, 4, 5, 6 },
+	{ 3, 7, 0, 1, 2, 4, 5, 6 },
+	{ 0, 1, 2, 7, 3, 4, 5, 6 },
+	{ 1, 2, 7, 0, 3, 4, 5, 6 },
+	{ 0, 2, 7, 1, 3, 4, 5, 6 },
+	{ 2, 7, 0, 1, 3, 4, 5, 6 },
+	{ 0, 1, 7, 2, 3, 4, 5, 6 },
+	{ 1, 7, 0, 2, 3, 4, 5, 6 },
+	{ 0, 7, 1, 2, 3, 4, 5, 6 },
+	{ 7, 0, 1, 2, 3, 4, 5, 6 },
+	{ 0, 1, 2, 3, 4, 5, 6, 7 },
+	{ 1, 2, 3, 4, 5, 6, 0, 7 },
+	{ 0, 2, 3, 4, 5, 6, 1, 7 },
+	{ 2, 3, 4, 5, 6, 0, 1, 7 },
+	{ 0, 1, 3, 4, 5, 6, 2, 7 },
+	{ 1, 3, 4, 5, 6, 0, 2, 7 },
+	{ 0, 3, 4, 5, 6, 1, 2, 7 },
+	{ 3, 4, 5, 6, 0, 1, 2, 7 },
+	{ 0, 1, 2, 4, 5, 6, 3, 7 },
+	{ 1, 2, 4, 5, 6, 0, 3, 7 },
+	{ 0, 2, 4, 5, 6, 1, 3, 7 },
+	{ 2, 4, 5, 6, 0, 1, 3, 7 },
+	{ 0, 1, 4, 5, 6, 2, 3, 7 },
+	{ 1, 4, 5, 6, 0, 2, 3, 7 },
+	{ 0, 4, 5, 6, 1, 2, 3, 7 },
+	{ 4, 5, 6, 0, 1, 2, 3, 7 },
+	{ 0, 1, 2, 3, 5, 6, 4, 7 },
+	{ 1, 2, 3, 5, 6, 0, 4, 7 },
+	{ 0, 2, 3, 5, 6, 1, 4, 7 },
+	{ 2, 3, 5, 6, 0, 1, 4, 7 },
+	{ 0, 1, 3, 5, 6, 2, 4, 7 },
+	{ 1, 3, 5, 6, 0, 2, 4, 7 },
+	{ 0, 3, 5, 6, 1, 2, 4, 7 },
+	{ 3, 5, 6, 0, 1, 2, 4, 7 },
+	{ 0, 1, 2, 5, 6, 3, 4, 7 },
+	{ 1, 2, 5, 6, 0, 3, 4, 7 },
+	{ 0, 2, 5, 6, 1, 3, 4, 7 },
+	{ 2, 5, 6, 0, 1, 3, 4, 7 },
+	{ 0, 1, 5, 6, 2, 3, 4, 7 },
+	{ 1, 5, 6, 0, 2, 3, 4, 7 },
+	{ 0, 5, 6, 1, 2, 3, 4, 7 },
+	{ 5, 6, 0, 1, 2, 3, 4, 7 },
+	{ 0, 1, 2, 3, 4, 6, 5, 7 },
+	{ 1, 2, 3, 4, 6, 0, 5, 7 },
+	{ 0, 2, 3, 4, 6, 1, 5, 7 },
+	{ 2, 3, 4, 6, 0, 1, 5, 7 },
+	{ 0, 1, 3, 4, 6, 2, 5, 7 },
+	{ 1, 3, 4, 6, 0, 2, 5, 7 },
+	{ 0, 3, 4, 6, 1, 2, 5, 7 },
+	{ 3, 4, 6, 0, 1, 2, 5, 7 },
+	{ 0, 1, 2, 4, 6, 3, 5, 7 },
+	{ 1, 2, 4, 6, 0, 3, 5, 7 },
+	{ 0, 2, 4, 6, 1, 3, 5, 7 },
+	{ 2, 4, 6, 0, 1, 3, 5, 7 },
+	{ 0, 1, 4, 6, 2, 3, 5, 7 },
+	{ 1, 4, 6, 0, 2, 3, 5, 7 },
+	{ 0, 4, 6, 1, 2, 3, 5, 7 },
+	{ 4, 6, 0, 1, 2, 3, 5, 7 },
+	{ 0, 1, 2, 3, 6, 4, 5, 7 },
+	{ 1, 2, 3, 6, 0, 4, 5, 7 },
+	{ 0, 2, 3, 6, 1, 4, 5, 7 },
+	{ 2, 3, 6, 0, 1, 4, 5, 7 },
+	{ 0, 1, 3, 6, 2, 4, 5, 7 },
+	{ 1, 3, 6, 0, 2, 4, 5, 7 },
+	{ 0, 3, 6, 1, 2, 4, 5, 7 },
+	{ 3, 6, 0, 1, 2, 4, 5, 7 },
+	{ 0, 1, 2, 6, 3, 4, 5, 7 },
+	{ 1, 2, 6, 0, 3, 4, 5, 7 },
+	{ 0, 2, 6, 1, 3, 4, 5, 7 },
+	{ 2, 6, 0, 1, 3, 4, 5, 7 },
+	{ 0, 1, 6, 2, 3, 4, 5, 7 },
+	{ 1, 6, 0, 2, 3, 4, 5, 7 },
+	{ 0, 6, 1, 2, 3, 4, 5, 7 },
+	{ 6, 0, 1, 2, 3, 4, 5, 7 },
+	{ 0, 1, 2, 3, 4, 5, 6, 7 },
+	{ 1, 2, 3, 4, 5, 0, 6, 7 },
+	{ 0, 2, 3, 4, 5, 1, 6, 7 },
+	{ 2, 3, 4, 5, 0, 1, 6, 7 },
+	{ 0, 1, 3, 4, 5, 2, 6, 7 },
+	{ 1, 3, 4, 5, 0, 2, 6, 7 },
+	{ 0, 3, 4, 5, 1, 2, 6, 7 },
+	{ 3, 4, 5, 0, 1, 2, 6, 7 },
+	{ 0, 1, 2, 4, 5, 3, 6, 7 },
+	{ 1, 2, 4, 5, 0, 3, 6, 7 },
+	{ 0, 2, 4, 5, 1, 3, 6, 7 },
+	{ 2, 4, 5, 0, 1, 3, 6, 7 },
+	{ 0, 1, 4, 5, 2, 3, 6, 7 },
+	{ 1, 4, 5, 0, 2, 3, 6, 7 },
+	{ 0, 4, 5, 1, 2, 3, 6, 7 },
+	{ 4, 5, 0, 1, 2, 3, 6, 7 },
+	{ 0, 1, 2, 3, 5, 4, 6, 7 },
+	{ 1, 2, 3, 5, 0, 4, 6, 7 },
+	{ 0, 2, 3, 5, 1, 4, 6, 7 },
+	{ 2, 3, 5, 0, 1, 4, 6, 7 },
+	{ 0, 1, 3, 5, 2, 4, 6, 7 },
+	{ 1, 3, 5, 0, 2, 4, 6, 7 },
+	{ 0, 3, 5, 1, 2, 4, 6, 7 },
+	{ 3, 5, 0, 1, 2, 4, 6, 7 },
+	{ 0, 1, 2, 5, 3, 4, 6, 7 },
+	{ 1, 2, 5, 0, 3, 4, 6, 7 },
+	{ 0, 2, 5, 1, 3, 4, 6, 7 },
+	{ 2, 5, 0, 1, 3, 4, 6, 7 },
+	{ 0, 1, 5, 2, 3, 4, 6, 7 },
+	{ 1, 5, 0, 2, 3, 4, 6, 7 },
+	{ 0, 5, 1, 2, 3, 4, 6, 7 },
+	{ 5, 0, 1, 2, 3, 4, 6, 7 },
+	{ 0, 1, 2, 3, 4, 5, 6, 7 },
+	{ 1, 2, 3, 4, 0, 5, 6, 7 },
+	{ 0, 2, 3, 4, 1, 5, 6, 7 },
+	{ 2, 3, 4, 0, 1, 5, 6, 7 },
+	{ 0, 1, 3, 4, 2, 5, 6, 7 },
+	{ 1, 3, 4, 0, 2, 5, 6, 7 },
+	{ 0, 3, 4, 1, 2, 5, 6, 7 },
+	{ 3, 4, 0, 1, 2, 5, 6, 7 },
+	{ 0, 1, 2, 4, 3, 5, 6, 7 },
+	{ 1, 2, 4, 0, 3, 5, 6, 7 },
+	{ 0, 2, 4, 1, 3, 5, 6, 7 },
+	{ 2, 4, 0, 1, 3, 5, 6, 7 },
+	{ 0, 1, 4, 2, 3, 5, 6, 7 },
+	{ 1, 4, 0, 2, 3, 5, 6, 7 },
+	{ 0, 4, 1, 2, 3, 5, 6, 7 },
+	{ 4, 0, 1, 2, 3, 5, 6, 7 },
+	{ 0, 1, 2, 3, 4, 5, 6, 7 },
+	{ 1, 2, 3, 0, 4, 5, 6, 7 },
+	{ 0, 2, 3, 1, 4, 5, 6, 7 },
+	{ 2, 3, 0, 1, 4, 5, 6, 7 },
+	{ 0, 1, 3, 2, 4, 5, 6, 7 },
+	{ 1, 3, 0, 2, 4, 5, 6, 7 },
+	{ 0, 3, 1, 2, 4, 5, 6, 7 },
+	{ 3, 0, 1, 2, 4, 5, 6, 7 },
+	{ 0, 1, 2, 3, 4, 5, 6, 7 },
+	{ 1, 2, 0, 3, 4, 5, 6, 7 },
+	{ 0, 2, 1, 3, 4, 5, 6, 7 },
+	{ 2, 0, 1, 3, 4, 5, 6, 7 },
+	{ 0, 1, 2, 3, 4, 5, 6, 7 },
+	{ 1, 0, 2, 3, 4, 5, 6, 7 },
+	{ 0, 1, 2, 3, 4, 5, 6, 7 },
+	{ 0, 1, 2, 3, 4, 5, 6, 7 }
+};
+
+// ėp߂gr֐B
+int compare_int(const void* a, const void* b)
+{
+	int x = *(const int*)a;
+	int y = *(const int*)b;
+	return (x > y) - (x < y);
+}
+
+int compare_float(const void* a, const void* b)
+{
+	float x = *(const float*)a;
+	float y = *(const float*)b;
+	return (x > y) - (x < y);
+}
+
+// ėp߂gAz a ɕבւ֐B
+void sort_general_epi32(int a[], int length)
+{
+	qsort(a, length, sizeof(int), compare_int);
+}
+
+// oCgjbN}[W̌㔼B
+// oCgjbNɂȂĂ 8 ̗vfɕׂB
+__m256i bitonic_merge_epi32(__m256i v)
+{
+	// 4 ꂽvfrB
+	__m256i w = _mm256_permute2x128_si256(v, v, 1);
+	v = _mm256_blend_epi32(_mm256_min_epi32(v, w), _mm256_max_epi32(v, w), 0xF0);
+
+	// 2 ꂽvfrB
+	w = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+	v = _mm256_blend_epi32(_mm256_min_epi32(v, w), _mm256_max_epi32(v, w), 0xCC);
+
+	// ׂ̗vfrB
+	w = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+	v = _mm256_blend_epi32(_mm256_min_epi32(v, w), _mm256_max_epi32(v, w), 0xAA);
+
+	return v;
+}
+
+// oCgjbN\[gŁA1 ̃WX^ 8 ̗vfɕׂ֐B
+// eił͗vfւxNgƂ̍ŏlƍől߁Ablend őIԁB
+__m256i sort_network8_epi32(__m256i v)
+{
+	// 2 Aƍ~݂ɕׂB
+	__m256i w = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+	v = _mm256_blend_epi32(_mm256_min_epi32(v, w), _mm256_max_epi32(v, w), 0x66);
+
+	// 4 Aƍ~݂ɕׂB
+	w = _mm256_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2));
+	v = _mm256_blend_epi32(_mm256_min_epi32(v, w), _mm256_max_epi32(v, w), 0x3C);
+
+	w = _mm256_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1));
+	v = _mm256_blend_epi32(_mm256_min_epi32(v, w), _mm256_max_epi32(v, w), 0x5A);
+
+	// 8 ŜɕׂB
+	return bitonic_merge_epi32(v);
+}
+
+// \[eBOlbg[NŁA16 ȉ̗vfɕׂ֐B
+void sort_network_epi32(int a[], int length)
+{
+	// Ȃ͍őlŖ߂B
+	int buffer[16];
+
+	for (int i = 0; i < 16; i++)
+	{
+		buffer[i] = INT_MAX;
+	}
+
+	memcpy(buffer, a, sizeof(int) * length);
+
+	__m256i low256 = sort_network8_epi32(_mm256_loadu_si256((__m256i*)(&buffer[0])));
+	__m256i high256 = sort_network8_epi32(_mm256_loadu_si256((__m256i*)(&buffer[8])));
+
+	// Еtɂ 16 ŃoCgjbNɂȂ̂ŁA
+	//  8 Ƒ傫 8 ɕāAꂼׂB
+	high256 = _mm256_permutevar8x32_epi32(high256, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+
+	__m256i min256 = _mm256_min_epi32(low256, high256);
+	__m256i max256 = _mm256_max_epi32(low256, high256);
+
+	_mm256_storeu_si256((__m256i*)(&buffer[0]), bitonic_merge_epi32(min256));
+	_mm256_storeu_si256((__m256i*)(&buffer[8]), bitonic_merge_epi32(max256));
+
+	memcpy(a, buffer, sizeof(int) * length);
+}
+
+// 8 ̗vfAs{bgȉ̗vf͍݈̏ʒuɁA傫vf͉Ȅ݈ʒuɏފ֐B
+void partition_store_epi32(__m256i v, __m256i pivot256, int greater_equal, int a[], int* write_left, int* write_right)
+{
+	// EɈڂvf̃}XNB
+	// greater_equal ̂Ƃ́As{bgƓvfEɈڂB
+	__m256i greater256 = greater_equal
+		? _mm256_xor_si256(_mm256_cmpgt_epi32(pivot256, v), _mm256_set1_epi32(-1))
+		: _mm256_cmpgt_epi32(v, pivot256);
+
+	int mask = _mm256_movemask_ps(_mm256_castsi256_ps(greater256));
+	int greater_count = __popcnt(mask);
+
+#ifdef __AVX512VL__
+	// AVX-512 ł compress ߂ŁAI񂾗vfl߂ďށB
+	_mm256_mask_compressstoreu_epi32(&a[*write_left], (__mmask8)~mask, v);
+	_mm256_mask_compressstoreu_epi32(&a[*write_right - greater_count], (__mmask8)mask, v);
+#else
+	// s{bgȉ̗vfOɁA傫vfɕׂB
+	__m256i permutation256 = _mm256_loadu_si256((const __m256i*)partition_permutation[mask]);
+	__m256i permuted256 = _mm256_permutevar8x32_epi32(v, permutation256);
+
+	// 8 SĂ𗼑ɏ݁AKvȕ݈ʒui߂B
+	// ޑOɓǂݍł̂ŁA܂ǂłȂvf㏑ȂB
+	_mm256_storeu_si256((__m256i*)(&a[*write_left]), permuted256);
+	_mm256_storeu_si256((__m256i*)(&a[*write_right - 8]), permuted256);
+#endif
+
+	*write_left += 8 - greater_count;
+	*write_right -= greater_count;
+}
+
+// SIMD ߂gAa[left]  a[right - 1] s{bg 2 ɕ֐B
+// s{bgȉ̗vfOɁA傫vfɈڂA̐擪̈ʒuԂB
+// greater_equal  0 ȊOȂAs{bgƓvfɈڂB
+// ͈̗͂vf 16 ȏł邱ƁB
+int partition_epi32(int a[], int left, int right, int pivot, int greater_equal)
+{
+	__m256i pivot256 = _mm256_set1_epi32(pivot);
+
+	// ŏƍŌ 8 ɓǂłAޏꏊ󂯂B
+	__m256i left256 = _mm256_loadu_si256((__m256i*)(&a[left]));
+	__m256i right256 = _mm256_loadu_si256((__m256i*)(&a[right - 8]));
+
+	int read_left = left + 8;
+	int read_right = right - 8;
+	int write_left = left;
+	int write_right = right;
+
+	// 󂫂ȂǂނƁA 8 ̋󂫂ɎcB
+	while (read_right - read_left >= 8)
+	{
+		__m256i v;
+
+		if (read_left - write_left <= write_right - read_right)
+		{
+			v = _mm256_loadu_si256((__m256i*)(&a[read_left]));
+			read_left += 8;
+		}
+		else
+		{
+			read_right -= 8;
+			v = _mm256_loadu_si256((__m256i*)(&a[read_right]));
+		}
+
+		partition_store_epi32(v, pivot256, greater_equal, a, &write_left, &write_right);
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	int rest[8];
+	int rest_count = read_right - read_left;
+	memcpy(rest, &a[read_left], sizeof(int) * rest_count);
+
+	for (int i = 0; i < rest_count; i++)
+	{
+		if (greater_equal ? rest[i] >= pivot : rest[i] > pivot)
+		{
+			a[--write_right] = rest[i];
+		}
+		else
+		{
+			a[write_left++] = rest[i];
+		}
+	}
+
+	// ŏɓǂ 16 ށB
+	partition_store_epi32(left256, pivot256, greater_equal, a, &write_left, &write_right);
+	partition_store_epi32(right256, pivot256, greater_equal, a, &write_left, &write_right);
+
+	return write_left;
+}
+
+// 3 ̒l̒l߂֐B
+int median_of_three_epi32(int x, int y, int z)
+{
+	if (x > y)
+	{
+		int t = x;
+		x = y;
+		y = t;
+	}
+
+	// x <= y Ȃ̂ŁAz ̈ʒuŌ܂B
+	return z < x ? x : (z > y ? y : z);
+}
+
+// ̐[̏߂֐B
+// vf̑ΐ 2 {𒴂ĕAs{bg̑Iѕ΂ĂƂ݂ȂB
+int depth_limit(int length)
+{
+	unsigned long index;
+	_BitScanReverse(&index, (unsigned long)length | 1);
+	return 2 * (int)index;
+}
+
+// ėp߂gAq[v i Ԗڂ̗vfq菬ȂȂʒu܂ŉ֐B
+void sift_down_epi32(int a[], int length, int i)
+{
+	int value = a[i];
+
+	while (2 * i + 1 < length)
+	{
+		int child = 2 * i + 1;
+
+		if (child + 1 < length && a[child + 1] > a[child])
+		{
+			child++;
+		}
+
+		if (a[child] <= value)
+		{
+			break;
+		}
+
+		a[i] = a[child];
+		i = child;
+	}
+
+	a[i] = value;
+}
+
+// ėp߂gAq[v\[gŔz a ɕבւ֐B
+// NCbN\[g̕΂葱͈͂ɎgAňł O(n log n) ɗ}B
+void heap_sort_epi32(int a[], int length)
+{
+	for (int i = length / 2 - 1; i >= 0; i--)
+	{
+		sift_down_epi32(a, length, i);
+	}
+
+	for (int end = length - 1; end > 0; end--)
+	{
+		int t = a[0];
+		a[0] = a[end];
+		a[end] = t;
+		sift_down_epi32(a, end, 0);
+	}
+}
+
+// SIMD ߂gAz a ɕבւ֐B
+// s{bgł̕ SIMD ߂ōsNCbN\[gB
+void sort_epi32(int a[], int length)
+{
+	// ͈͂̃X^bNB
+	// ɏ̂ŁA[͗vf̑ΐŎ܂B
+	int stack_left[64];
+	int stack_right[64];
+	int stack_budget[64];
+	int depth = 1;
+
+	stack_left[0] = 0;
+	stack_right[0] = length;
+	stack_budget[0] = depth_limit(length);
+
+	while (depth > 0)
+	{
+		depth--;
+		int left = stack_left[depth];
+		int right = stack_right[depth];
+		int budget = stack_budget[depth];
+
+		while (right - left > SORT_NETWORK_LENGTH)
+		{
+			// ΂葱͈͂́Aq[v\[gɐ؂ւB
+			// בւς݂ɂȂ̂ŁA͈͂ɂă\[eBOlbg[N΂B
+			if (budget == 0)
+			{
+				heap_sort_epi32(&a[left], right - left);
+				left = right;
+				break;
+			}
+
+			budget--;
+
+			int n = right - left;
+			int pivot = median_of_three_epi32(a[left + n / 4], a[left + n / 2], a[left + n / 4 * 3]);
+			int boundary = partition_epi32(a, left, right, pivot, 0);
+
+			if (boundary == right)
+			{
+				// SĂ̗vfs{bgȉȂ̂ŁAs{bgƓvfɏW߂B
+				// ͑Săs{bgƓ̂ŁAO𑱂ĕׂB
+				right = partition_epi32(a, left, right, pivot, 1);
+				continue;
+			}
+
+			// 傫X^bNɐς݁A𑱂ďB
+			if (boundary - left < right - boundary)
+			{
+				stack_left[depth] = boundary;
+				stack_right[depth] = right;
+				stack_budget[depth] = budget;
+				right = boundary;
+			}
+			else
+			{
+				stack_left[depth] = left;
+				stack_right[depth] = boundary;
+				stack_budget[depth] = budget;
+				left = boundary;
+			}
+
+			depth++;
+		}
+
+		sort_network_epi32(&a[left], right - left);
+	}
+}
+
+// SIMD ߂gAz a ̒ŏl߂֐B
+int min_of_epi32(const int a[], int length)
+{
+	int i = 0;
+	__m256i min_value256 = _mm256_set1_epi32(INT_MAX);
+
+	for (; i + 7 < length; i += 8)
+	{
+		min_value256 = _mm256_min_epi32(min_value256, _mm256_loadu_si256((__m256i*)(&a[i])));
+	}
+
+	int result[8];
+	_mm256_storeu_si256((__m256i*)result, min_value256);
+
+	int min_value = result[0];
+
+	for (int j = 1; j < 8; j++)
+	{
+		min_value = result[j] < min_value ? result[j] : min_value;
+	}
+
+	// c̗vfB
+	for (; i < length; i++)
+	{
+		min_value = a[i] < min_value ? a[i] : min_value;
+	}
+
+	return min_value;
+}
+
+// ėp߂gAɕׂƂ n Ԗځi0 琔jɂȂvf߂֐B
+// Hoare ̕ŕБ𑱂ĒׂNCbNZNgB
+// ΂葱Ƃ́Ac͈̔͂q[v\[gčňł O(n log n) ɗ}B
+// z a ́An ԖڂOɂȉ̗vfAɂȏ̗vfԂ悤ɓւB
+int nth_element_general_epi32(int a[], int length, int n)
+{
+	int left = 0;
+	int right = length - 1;
+	int budget = depth_limit(length);
+
+	while (left < right)
+	{
+		if (budget == 0)
+		{
+			heap_sort_epi32(&a[left], right - left + 1);
+			break;
+		}
+
+		budget--;
+
+		// 3 ̒l̒ls{bgɂāA͈͂̐擪ɒuB
+		// s{bg擪ɂ̂ŁA͋ɂȂȂB
+		int count = right - left + 1;
+		int x = left + count / 4;
+		int y = left + count / 2;
+		int z = left + count / 4 * 3;
+		int middle = a[x] > a[y]
+			? (a[y] > a[z] ? y : (a[x] > a[z] ? z : x))
+			: (a[x] > a[z] ? x : (a[y] > a[z] ? z : y));
+
+		int pivot = a[middle];
+		a[middle] = a[left];
+		a[left] = pivot;
+
+		int i = left - 1;
+		int j = right + 1;
+
+		for (;;)
+		{
+			do
+			{
+				i++;
+			} while (a[i] < pivot);
+
+			do
+			{
+				j--;
+			} while (a[j] > pivot);
+
+			if (i >= j)
+			{
+				break;
+			}
+
+			int t = a[i];
+			a[i] = a[j];
+			a[j] = t;
+		}
+
+		// a[left]  a[j] ̓s{bgȉAa[j + 1]  a[right] ̓s{bgȏB
+		if (n <= j)
+		{
+			right = j;
+		}
+		else
+		{
+			left = j + 1;
+		}
+	}
+
+	return a[n];
+}
+
+int nth_element_epi32(int a[], int length, int n);
+
+// 5 ̒l͈͂̐擪ɏW߁A̒l߂֐B
+// l̒lȉ̗vfƈȏ̗vf́Aꂼ͈͂ 3 ȏ゠B
+int median_of_medians_epi32(int a[], int left, int right)
+{
+	int median_count = 0;
+
+	for (int i = left; i + 4 < right; i += 5)
+	{
+		sort_network_epi32(&a[i], 5);
+
+		int t = a[left + median_count];
+		a[left + median_count] = a[i + 2];
+		a[i + 2] = t;
+		median_count++;
+	}
+
+	return nth_element_epi32(&a[left], median_count, median_count / 2);
+}
+
+// SIMD ߂gAɕׂƂ n Ԗځi0 琔jɂȂvf߂֐B
+// Б𑱂ĒׂNCbNZNgB
+// ΂葱Ƃ͒l̒ls{bgɂāAňł O(n) ɗ}B
+// z a ́An ԖڂOɂȉ̗vfAɂȏ̗vfԂ悤ɓւB
+int nth_element_epi32(int a[], int length, int n)
+{
+	int left = 0;
+	int right = length;
+	int budget = depth_limit(length);
+
+	while (right - left > SORT_NETWORK_LENGTH)
+	{
+		int count = right - left;
+		int pivot = budget > 0
+			? median_of_three_epi32(a[left + count / 4], a[left + count / 2], a[left + count / 4 * 3])
+			: median_of_medians_epi32(a, left, right);
+		budget--;
+
+		int boundary = partition_epi32(a, left, right, pivot, 0);
+
+		if (boundary == right)
+		{
+			boundary = partition_epi32(a, left, right, pivot, 1);
+
+			// ͑Săs{bgƓB
+			if (n >= boundary)
+			{
+				return pivot;
+			}
+
+			right = boundary;
+		}
+		else if (n < boundary)
+		{
+			right = boundary;
+		}
+		else
+		{
+			left = boundary;
+		}
+	}
+
+	sort_network_epi32(&a[left], right - left);
+
+	return a[n];
+}
+
+// SIMD ߂gAz a  p p[Z^C߂֐B
+// ʂ̊Ԃ͐`ԂB
+// p  0  100 ͈̔͂Ɋۂ߂BvfȂƂ p  NaN ̂Ƃ NaN ԂB
+// z a ͓ւB
+double percentile_epi32(int a[], int length, double p)
+{
+	if (length <= 0 || isnan(p))
+	{
+		return NAN;
+	}
+
+	p = p < 0.0 ? 0.0 : (p > 100.0 ? 100.0 : p);
+
+	double position = p / 100.0 * (length - 1);
+	int k = (int)position;
+	double fraction = position - k;
+
+	double value = nth_element_epi32(a, length, k);
+
+	if (fraction > 0.0)
+	{
+		// k Ԗڂ͂ȏ̗vfȂ̂ŁA̍ŏl k + 1 ԖڂɂȂB
+		double next = min_of_epi32(&a[k + 1], length - k - 1);
+		value += (next - value) * fraction;
+	}
+
+	return value;
+}
+
+// SIMD ߂gAz a ̒l߂֐B
+// z a ͓ւB
+double median_epi32(int a[], int length)
+{
+	return percentile_epi32(a, length, 50.0);
+}
+
+// ėp߂gAz a ɕבւ֐B
+void sort_general_ps(float a[], int length)
+{
+	qsort(a, length, sizeof(float), compare_float);
+}
+
+// oCgjbN}[W̌㔼B
+__m256 bitonic_merge_ps(__m256 v)
+{
+	__m256 w = _mm256_permute2f128_ps(v, v, 1);
+	v = _mm256_blend_ps(_mm256_min_ps(v, w), _mm256_max_ps(v, w), 0xF0);
+
+	w = _mm256_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2));
+	v = _mm256_blend_ps(_mm256_min_ps(v, w), _mm256_max_ps(v, w), 0xCC);
+
+	w = _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+	v = _mm256_blend_ps(_mm256_min_ps(v, w), _mm256_max_ps(v, w), 0xAA);
+
+	return v;
+}
+
+// oCgjbN\[gŁA1 ̃WX^ 8 ̗vfɕׂ֐B
+__m256 sort_network8_ps(__m256 v)
+{
+	__m256 w = _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+	v = _mm256_blend_ps(_mm256_min_ps(v, w), _mm256_max_ps(v, w), 0x66);
+
+	w = _mm256_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2));
+	v = _mm256_blend_ps(_mm256_min_ps(v, w), _mm256_max_ps(v, w), 0x3C);
+
+	w = _mm256_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1));
+	v = _mm256_blend_ps(_mm256_min_ps(v, w), _mm256_max_ps(v, w), 0x5A);
+
+	return bitonic_merge_ps(v);
+}
+
+// \[eBOlbg[NŁA16 ȉ̗vfɕׂ֐B
+void sort_network_ps(float a[], int length)
+{
+	float buffer[16];
+
+	for (int i = 0; i < 16; i++)
+	{
+		buffer[i] = INFINITY;
+	}
+
+	memcpy(buffer, a, sizeof(float) * length);
+
+	__m256 low256 = sort_network8_ps(_mm256_loadu_ps(&buffer[0]));
+	__m256 high256 = sort_network8_ps(_mm256_loadu_ps(&buffer[8]));
+
+	high256 = _mm256_permutevar8x32_ps(high256, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+
+	__m256 min256 = _mm256_min_ps(low256, high256);
+	__m256 max256 = _mm256_max_ps(low256, high256);
+
+	_mm256_storeu_ps(&buffer[0], bitonic_merge_ps(min256));
+	_mm256_storeu_ps(&buffer[8], bitonic_merge_ps(max256));
+
+	memcpy(a, buffer, sizeof(float) * length);
+}
+
+void partition_store_ps(__m256 v, __m256 pivot256, int greater_equal, float a[], int* write_left, int* write_right)
+{
+	__m256 greater256 = greater_equal
+		? _mm256_cmp_ps(v, pivot256, _CMP_GE_OQ)
+		: _mm256_cmp_ps(v, pivot256, _CMP_GT_OQ);
+
+	int mask = _mm256_movemask_ps(greater256);
+	int greater_count = __popcnt(mask);
+
+#ifdef __AVX512VL__
+	_mm256_mask_compressstoreu_ps(&a[*write_left], (__mmask8)~mask, v);
+	_mm256_mask_compressstoreu_ps(&a[*write_right - greater_count], (__mmask8)mask, v);
+#else
+	__m256i permutation256 = _mm256_loadu_si256((const __m256i*)partition_permutation[mask]);
+	__m256 permuted256 = _mm256_permutevar8x32_ps(v, permutation256);
+
+	_mm256_storeu_ps(&a[*write_left], permuted256);
+	_mm256_storeu_ps(&a[*write_right - 8], permuted256);
+#endif
+
+	*write_left += 8 - greater_count;
+	*write_right -= greater_count;
+}
+
+// SIMD ߂gAa[left]  a[right - 1] s{bg 2 ɕ֐B
+//  partition_epi32 ƓB
+int partition_ps(float a[], int left, int right, float pivot, int greater_equal)
+{
+	__m256 pivot256 = _mm256_set1_ps(pivot);
+
+	__m256 left256 = _mm256_loadu_ps(&a[left]);
+	__m256 right256 = _mm256_loadu_ps(&a[right - 8]);
+
+	int read_left = left + 8;
+	int read_right = right - 8;
+	int write_left = left;
+	int write_right = right;
+
+	while (read_right - read_left >= 8)
+	{
+		__m256 v;
+
+		if (read_left - write_left <= write_right - read_right)
+		{
+			v = _mm256_loadu_ps(&a[read_left]);
+			read_left += 8;
+		}
+		else
+		{
+			read_right -= 8;
+			v = _mm256_loadu_ps(&a[read_right]);
+		}
+
+		partition_store_ps(v, pivot256, greater_equal, a, &write_left, &write_right);
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	float rest[8];
+	int rest_count = read_right - read_left;
+	memcpy(rest, &a[read_left], sizeof(float) * rest_count);
+
+	for (int i = 0; i < rest_count; i++)
+	{
+		if (greater_equal ? rest[i] >= pivot : rest[i] > pivot)
+		{
+			a[--write_right] = rest[i];
+		}
+		else
+		{
+			a[write_left++] = rest[i];
+		}
+	}
+
+	partition_store_ps(left256, pivot256, greater_equal, a, &write_left, &write_right);
+	partition_store_ps(right256, pivot256, greater_equal, a, &write_left, &write_right);
+
+	return write_left;
+}
+
+float median_of_three_ps(float x, float y, float z)
+{
+	if (x > y)
+	{
+		float t = x;
+		x = y;
+		y = t;
+	}
+
+	return z < x ? x : (z > y ? y : z);
+}
+
+void sift_down_ps(float a[], int length, int i)
+{
+	float value = a[i];
+
+	while (2 * i + 1 < length)
+	{
+		int child = 2 * i + 1;
+
+		if (child + 1 < length && a[child + 1] > a[child])
+		{
+			child++;
+		}
+
+		if (a[child] <= value)
+		{
+			break;
+		}
+
+		a[i] = a[child];
+		i = child;
+	}
+
+	a[i] = value;
+}
+
+// ėp߂gAq[v\[gŔz a ɕבւ֐B
+void heap_sort_ps(float a[], int length)
+{
+	for (int i = length / 2 - 1; i >= 0; i--)
+	{
+		sift_down_ps(a, length, i);
+	}
+
+	for (int end = length - 1; end > 0; end--)
+	{
+		float t = a[0];
+		a[0] = a[end];
+		a[end] = t;
+		sift_down_ps(a, end, 0);
+	}
+}
+
+// SIMD ߂gAz a ɕבւ֐B
+// NaN ܂܂ȂƁB
+void sort_ps(float a[], int length)
+{
+	int stack_left[64];
+	int stack_right[64];
+	int stack_budget[64];
+	int depth = 1;
+
+	stack_left[0] = 0;
+	stack_right[0] = length;
+	stack_budget[0] = depth_limit(length);
+
+	while (depth > 0)
+	{
+		depth--;
+		int left = stack_left[depth];
+		int right = stack_right[depth];
+		int budget = stack_budget[depth];
+
+		while (right - left > SORT_NETWORK_LENGTH)
+		{
+			if (budget == 0)
+			{
+				heap_sort_ps(&a[left], right - left);
+				left = right;
+				break;
+			}
+
+			budget--;
+
+			int n = right - left;
+			float pivot = median_of_three_ps(a[left + n / 4], a[left + n / 2], a[left + n / 4 * 3]);
+			int boundary = partition_ps(a, left, right, pivot, 0);
+
+			if (boundary == right)
+			{
+				right = partition_ps(a, left, right, pivot, 1);
+				continue;
+			}
+
+			if (boundary - left < right - boundary)
+			{
+				stack_left[depth] = boundary;
+				stack_right[depth] = right;
+				stack_budget[depth] = budget;
+				right = boundary;
+			}
+			else
+			{
+				stack_left[depth] = left;
+				stack_right[depth] = boundary;
+				stack_budget[depth] = budget;
+				left = boundary;
+			}
+
+			depth++;
+		}
+
+		sort_network_ps(&a[left], right - left);
+	}
+}
+
+float min_of_ps(const float a[], int length)
+{
+	int i = 0;
+	__m256 min_value256 = _mm256_set1_ps(INFINITY);
+
+	for (; i + 7 < length; i += 8)
+	{
+		min_value256 = _mm256_min_ps(min_value256, _mm256_loadu_ps(&a[i]));
+	}
+
+	float result[8];
+	_mm256_storeu_ps(result, min_value256);
+
+	float min_value = result[0];
+
+	for (int j = 1; j < 8; j++)
+	{
+		min_value = result[j] < min_value ? result[j] : min_value;
+	}
+
+	for (; i < length; i++)
+	{
+		min_value = a[i] < min_value ? a[i] : min_value;
+	}
+
+	return min_value;
+}
+
+// ėp߂gAɕׂƂ n Ԗځi0 琔jɂȂvf߂֐B
+// ߕ nth_element_general_epi32 ƓBNaN ܂܂ȂƁB
+float nth_element_general_ps(float a[], int length, int n)
+{
+	int left = 0;
+	int right = length - 1;
+	int budget = depth_limit(length);
+
+	while (left < right)
+	{
+		if (budget == 0)
+		{
+			heap_sort_ps(&a[left], right - left + 1);
+			break;
+		}
+
+		budget--;
+
+		int count = right - left + 1;
+		int x = left + count / 4;
+		int y = left + count / 2;
+		int z = left + count / 4 * 3;
+		int middle = a[x] > a[y]
+			? (a[y] > a[z] ? y : (a[x] > a[z] ? z : x))
+			: (a[x] > a[z] ? x : (a[y] > a[z] ? z : y));
+
+		float pivot = a[middle];
+		a[middle] = a[left];
+		a[left] = pivot;
+
+		int i = left - 1;
+		int j = right + 1;
+
+		for (;;)
+		{
+			do
+			{
+				i++;
+			} while (a[i] < pivot);
+
+			do
+			{
+				j--;
+			} while (a[j] > pivot);
+
+			if (i >= j)
+			{
+				break;
+			}
+
+			float t = a[i];
+			a[i] = a[j];
+			a[j] = t;
+		}
+
+		if (n <= j)
+		{
+			right = j;
+		}
+		else
+		{
+			left = j + 1;
+		}
+	}
+
+	return a[n];
+}
+
+float nth_element_ps(float a[], int length, int n);
+
+float median_of_medians_ps(float a[], int left, int right)
+{
+	int median_count = 0;
+
+	for (int i = left; i + 4 < right; i += 5)
+	{
+		sort_network_ps(&a[i], 5);
+
+		float t = a[left + median_count];
+		a[left + median_count] = a[i + 2];
+		a[i + 2] = t;
+		median_count++;
+	}
+
+	return nth_element_ps(&a[left], median_count, median_count / 2);
+}
+
+// SIMD ߂gAɕׂƂ n Ԗځi0 琔jɂȂvf߂֐B
+// NaN ܂܂ȂƁB
+float nth_element_ps(float a[], int length, int n)
+{
+	int left = 0;
+	int right = length;
+	int budget = depth_limit(length);
+
+	while (right - left > SORT_NETWORK_LENGTH)
+	{
+		int count = right - left;
+		float pivot = budget > 0
+			? median_of_three_ps(a[left + count / 4], a[left + count / 2], a[left + count / 4 * 3])
+			: median_of_medians_ps(a, left, right);
+		budget--;
+
+		int boundary = partition_ps(a, left, right, pivot, 0);
+
+		if (boundary == right)
+		{
+			boundary = partition_ps(a, left, right, pivot, 1);
+
+			if (n >= boundary)
+			{
+				return pivot;
+			}
+
+			right = boundary;
+		}
+		else if (n < boundary)
+		{
+			right = boundary;
+		}
+		else
+		{
+			left = boundary;
+		}
+	}
+
+	sort_network_ps(&a[left], right - left);
+
+	return a[n];
+}
+
+// SIMD ߂gAz a  p p[Z^C߂֐B
+double percentile_ps(float a[], int length, double p)
+{
+	if (length <= 0 || isnan(p))
+	{
+		return NAN;
+	}
+
+	p = p < 0.0 ? 0.0 : (p > 100.0 ? 100.0 : p);
+
+	double position = p / 100.0 * (length - 1);
+	int k = (int)position;
+	double fraction = position - k;
+
+	double value = nth_element_ps(a, length, k);
+
+	if (fraction > 0.0)
+	{
+		double next = min_of_ps(&a[k + 1], length - k - 1);
+		value += (next - value) * fraction;
+	}
+
+	return value;
+}
+
+// SIMD ߂gAz a ̒l߂֐B
+double median_ps(float a[], int length)
+{
+	return percentile_ps(a, length, 50.0);
+}
+
+void print_array_epi32(const char* name, const int a[], int length)
+{
+	printf("%s", name);
+
+	for (int i = 0; i < length; i++)
+	{
+		printf(" %d", a[i]);
+	}
+
+	printf("\n");
+}
+
+int main(void)
+{
+	int a[] = { 31, -4, 15, 9, 26, 5, 35, 8, 97, 93, 23, 84, 62, 64, 33, 83, 27, 95, 2, 88, 41, 97 };
+	int length = sizeof(a) / sizeof(int);
+	int b[sizeof(a) / sizeof(int)];
+	float c[] = { 2.5f, -1.0f, 3.25f, 0.0f, 9.5f, 4.0f, 7.75f, 1.5f, 6.0f, 8.0f, -3.5f, 5.5f, 2.0f, 3.0f, 4.5f, 0.5f, 1.0f };
+	int c_length = sizeof(c) / sizeof(float);
+
+	memcpy(b, a, sizeof(a));
+	sort_general_epi32(b, length);
+	print_array_epi32("sort_general_epi32:", b, length);
+
+	memcpy(b, a, sizeof(a));
+	sort_epi32(b, length);
+	print_array_epi32("sort_epi32:        ", b, length);
+
+	memcpy(b, a, sizeof(a));
+	printf("nth_element_general_epi32(5): %d\n", nth_element_general_epi32(b, length, 5));
+
+	memcpy(b, a, sizeof(a));
+	printf("nth_element_epi32(5):         %d\n", nth_element_epi32(b, length, 5));
+
+	memcpy(b, a, sizeof(a));
+	printf("median_epi32:                 %lf\n", median_epi32(b, length));
+
+	memcpy(b, a, sizeof(a));
+	printf("percentile_epi32(90):         %lf\n", percentile_epi32(b, length, 90.0));
+
+	printf("median_ps:                    %lf\n", median_ps(c, c_length));
+
+	sort_ps(c, c_length);
+	printf("sort_ps:");
+
+	for (int i = 0; i < c_length; i++)
+	{
+		printf(" %g", c[i]);
+	}
+
+	printf("\n");
+
+	// 傫ȔzőxrB
+	int large_length = 1 << 22;
+	int* large_a = (int*)malloc(sizeof(int) * large_length);
+	int* large_b = (int*)malloc(sizeof(int) * large_length);
+	float* large_c = (float*)malloc(sizeof(float) * large_length);
+	float* large_d = (float*)malloc(sizeof(float) * large_length);
+
+	if (large_a == NULL || large_b == NULL || large_c == NULL || large_d == NULL)
+	{
+		free(large_a);
+		free(large_b);
+		free(large_c);
+		free(large_d);
+		return 1;
+	}
+
+	srand(1);
+
+	for (int i = 0; i < large_length; i++)
+	{
+		large_a[i] = (int)(((unsigned int)rand() << 16) ^ (unsigned int)rand());
+		large_c[i] = (float)rand() / RAND_MAX;
+	}
+
+	memcpy(large_b, large_a, sizeof(int) * large_length);
+	clock_t start = clock();
+	sort_general_epi32(large_b, large_length);
+	printf("\nsort_general_epi32:        %d (%ld ms)\n", large_b[large_length / 2], (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	memcpy(large_b, large_a, sizeof(int) * large_length);
+	start = clock();
+	sort_epi32(large_b, large_length);
+	printf("sort_epi32:                %d (%ld ms)\n", large_b[large_length / 2], (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	// n Ԗڂ̗vf́Aėp߂̃NCbNZNgƔׂB
+	memcpy(large_b, large_a, sizeof(int) * large_length);
+	start = clock();
+	int nth = nth_element_general_epi32(large_b, large_length, large_length / 2);
+	clock_t general_time = clock() - start;
+	printf("nth_element_general_epi32: %d (%ld ms)\n", nth, (long)(general_time * 1000 / CLOCKS_PER_SEC));
+
+	memcpy(large_b, large_a, sizeof(int) * large_length);
+	start = clock();
+	nth = nth_element_epi32(large_b, large_length, large_length / 2);
+	clock_t simd_time = clock() - start;
+	printf("nth_element_epi32:         %d (%ld ms, %.2fx)\n", nth, (long)(simd_time * 1000 / CLOCKS_PER_SEC), (double)general_time / (simd_time > 0 ? simd_time : 1));
+
+	memcpy(large_d, large_c, sizeof(float) * large_length);
+	start = clock();
+	sort_general_ps(large_d, large_length);
+	printf("sort_general_ps:           %f (%ld ms)\n", large_d[large_length / 2], (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	memcpy(large_d, large_c, sizeof(float) * large_length);
+	start = clock();
+	sort_ps(large_d, large_length);
+	printf("sort_ps:                   %f (%ld ms)\n", large_d[large_length / 2], (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	memcpy(large_d, large_c, sizeof(float) * large_length);
+	start = clock();
+	float nth_ps = nth_element_general_ps(large_d, large_length, large_length / 2);
+	general_time = clock() - start;
+	printf("nth_element_general_ps:    %f (%ld ms)\n", nth_ps, (long)(general_time * 1000 / CLOCKS_PER_SEC));
+
+	memcpy(large_d, large_c, sizeof(float) * large_length);
+	start = clock();
+	nth_ps = nth_element_ps(large_d, large_length, large_length / 2);
+	simd_time = clock() - start;
+	printf("nth_element_ps:            %f (%ld ms, %.2fx)\n", nth_ps, (long)(simd_time * 1000 / CLOCKS_PER_SEC), (double)general_time / (simd_time > 0 ? simd_time : 1));
+
+	free(large_a);
+	free(large_b);
+	free(large_c);
+	free(large_d);
+
+	return 0;
+}
@@ -0,0 +1,629 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <time.h>
+#include <intrin.h>
+
+// SIMD ߂œWJłő̃rbgB
+// 1 vf 4 oCg̓ǂݍ݂ƃVtgiő 7 rbgjŎo߁A25 rbg܂ŁB
+#define MAX_SIMD_BITS 25
+
+// f[^̖ɒu]̃oCgB
+// ̗vfWJƂɁAz̊Oǂ܂Ȃ悤ɂB
+#define PACKED_PADDING 32
+
+// rbgpbNꂽ\\́B
+// evf base Ƃ̍iFrame of Referencej bits rbgŋl߂Ċi[B
+typedef struct
+{
+	unsigned char* data;
+	int length;
+	int bits;
+	int base;
+} packed_column;
+
+// ꂽ\\́B
+// ^CX^v̂悤ȏ̒lAO̗vfƂ̍ƂĊi[B
+// 擪̗vf̍ 0 ƂAfirst ɐ擪̒lB
+typedef struct
+{
+	packed_column deltas;
+	int first;
+} delta_column;
+
+// l value \̂ɕKvȃrbg߂֐B
+int bit_width(unsigned int value)
+{
+	unsigned long index;
+
+	if (!_BitScanReverse(&index, value))
+	{
+		return 0;
+	}
+
+	return (int)index + 1;
+}
+
+// z a Abase Ƃ̍ bits rbgŋl߂ɕϊ֐B
+packed_column pack_values(const unsigned int a[], int length, int bits, int base)
+{
+	packed_column column = { NULL, length, bits, base };
+	size_t bytes = ((size_t)length * bits + 7) / 8 + PACKED_PADDING;
+
+	column.data = (unsigned char*)calloc(bytes, 1);
+
+	if (column.data == NULL)
+	{
+		column.length = 0;
+		return column;
+	}
+
+	for (int i = 0; i < length; i++)
+	{
+		size_t bit = (size_t)i * bits;
+		unsigned long long word;
+
+		memcpy(&word, &column.data[bit / 8], sizeof(word));
+		word |= (unsigned long long)a[i] << (bit % 8);
+		memcpy(&column.data[bit / 8], &word, sizeof(word));
+	}
+
+	return column;
+}
+
+// z a rbgpbNꂽɕϊ֐B
+// ŏl base ƂAőlƂ̍܂ŏ̃rbggB
+packed_column packed_column_create(const int a[], int length)
+{
+	int min_value = INT_MAX;
+	int max_value = INT_MIN;
+
+	for (int i = 0; i < length; i++)
+	{
+		min_value = a[i] < min_value ? a[i] : min_value;
+		max_value = a[i] > max_value ? a[i] : max_value;
+	}
+
+	if (length == 0)
+	{
+		min_value = max_value = 0;
+	}
+
+	unsigned int* offsets = (unsigned int*)malloc(sizeof(unsigned int) * (length > 0 ? length : 1));
+	packed_column column = { NULL, 0, 0, 0 };
+
+	if (offsets == NULL)
+	{
+		return column;
+	}
+
+	for (int i = 0; i < length; i++)
+	{
+		offsets[i] = (unsigned int)a[i] - (unsigned int)min_value;
+	}
+
+	column = pack_values(offsets, length, bit_width((unsigned int)max_value - (unsigned int)min_value), min_value);
+	free(offsets);
+
+	return column;
+}
+
+// z a ꂽɕϊ֐B
+// ͍ŏ̍ base ƂărbgpbN̂ŁAłȂĂB
+delta_column delta_column_create(const int a[], int length)
+{
+	delta_column column = { { NULL, 0, 0, 0 }, length > 0 ? a[0] : 0 };
+	int* deltas = (int*)malloc(sizeof(int) * (length > 0 ? length : 1));
+
+	if (deltas == NULL)
+	{
+		return column;
+	}
+
+	for (int i = 0; i < length; i++)
+	{
+		deltas[i] = i == 0 ? 0 : a[i] - a[i - 1];
+	}
+
+	column.deltas = packed_column_create(deltas, length);
+	free(deltas);
+
+	return column;
+}
+
+void packed_column_free(packed_column* column)
+{
+	free(column->data);
+	column->data = NULL;
+	column->length = 0;
+}
+
+// ėp߂gA i Ԗڂ̗vfo֐B
+int packed_column_get(const packed_column* column, int i)
+{
+	size_t bit = (size_t)i * column->bits;
+	unsigned long long word;
+
+	memcpy(&word, &column->data[bit / 8], sizeof(word));
+
+	unsigned int mask = column->bits == 32 ? 0xFFFFFFFFu : (1u << column->bits) - 1;
+	return (int)(((unsigned int)(word >> (bit % 8)) & mask) + (unsigned int)column->base);
+}
+
+// 8 vfWJ邽߂̕\B
+// 8 vf bits oCg傤ǂɎ܂̂ŁA8 vfƂ̐擪͏ɃoCgEɂȂB
+//  4 vf͐擪A 4 vf high_offset oCg悩 16 oCgǂݍ݁A
+// evf܂ 4 oCgVbtŏW߂ĂAVtgƃ}XNŎoB
+typedef struct
+{
+	__m256i shuffle;
+	__m256i shift;
+	__m256i mask;
+	int high_offset;
+} unpack_table;
+
+unpack_table make_unpack_table(int bits)
+{
+	unpack_table table;
+	char shuffle[32];
+	int shift[8];
+
+	table.high_offset = (4 * bits) / 8;
+
+	for (int j = 0; j < 8; j++)
+	{
+		int bit = j * bits - (j < 4 ? 0 : table.high_offset * 8);
+		int byte = bit / 8;
+
+		for (int k = 0; k < 4; k++)
+		{
+			shuffle[j * 4 + k] = (char)(byte + k);
+		}
+
+		shift[j] = bit % 8;
+	}
+
+	table.shuffle = _mm256_loadu_si256((__m256i*)shuffle);
+	table.shift = _mm256_loadu_si256((__m256i*)shift);
+	table.mask = _mm256_set1_epi32(bits == 32 ? -1 : (int)((1u << bits) - 1));
+
+	return table;
+}
+
+// SIMD ߂gA 8 vf̂܂Ƃ܂ group WJ֐B
+// ʂ base 𑫂O̒lB
+__m256i unpack8(const packed_column* column, const unpack_table* table, int group)
+{
+	const unsigned char* p = &column->data[(size_t)group * column->bits];
+
+	__m128i low128 = _mm_loadu_si128((__m128i*)p);
+	__m128i high128 = _mm_loadu_si128((__m128i*)(p + table->high_offset));
+	__m256i bytes256 = _mm256_inserti128_si256(_mm256_castsi128_si256(low128), high128, 1);
+
+	__m256i words256 = _mm256_shuffle_epi8(bytes256, table->shuffle);
+	return _mm256_and_si256(_mm256_srlv_epi32(words256, table->shift), table->mask);
+}
+
+// 32 rbgt 8 ̗vfxNg̒Aŏɕ̗vfCfbNX߂֐B
+unsigned long find_first_non_zero_index_epi32(__m256i a)
+{
+	unsigned long index;
+	__m256 floating_point_a = _mm256_castsi256_ps(a);
+	int mask = _mm256_movemask_ps(floating_point_a);
+	_BitScanForward(&index, mask);
+	return index;
+}
+
+// 64 rbg̍vlXJ[lɕϊ֐B
+long long horizontal_add_epi64(__m256i sum256)
+{
+	long long result[4];
+	_mm256_storeu_si256((__m256i*)result, sum256);
+	return result[0] + result[1] + result[2] + result[3];
+}
+
+// 32 rbgt 8 ̗vfA64 rbgɕg sum256 ɑ֐B
+__m256i add_epi32_to_epi64(__m256i sum256, __m256i a256)
+{
+	sum256 = _mm256_add_epi64(sum256, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(a256)));
+	return _mm256_add_epi64(sum256, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(a256, 1)));
+}
+
+// ėp߂gȂSvf̘a߂֐B
+long long packed_sum_general(const packed_column* column)
+{
+	long long sum = 0;
+
+	for (int i = 0; i < column->length; i++)
+	{
+		sum += packed_column_get(column, i);
+	}
+
+	return sum;
+}
+
+// SIMD ߂gȂSvf̘a߂֐B
+// WJl̓WX^[̒ŎgA[ɂ͏oȂB
+// int ͈̔͂𒴂Ȃ悤ɁAa 64 rbgŋ߂B
+long long packed_sum(const packed_column* column)
+{
+	int groups = column->bits <= MAX_SIMD_BITS ? column->length / 8 : 0;
+	unpack_table table = make_unpack_table(column->bits);
+	__m256i low256 = _mm256_set1_epi64x(0xFFFFFFFF);
+
+	// WJl 0 ȏȂ̂ŁA64 rbg̃[̉ʂƏʂ 32 rbgʁXɑB
+	__m256i sum256_0 = _mm256_setzero_si256();
+	__m256i sum256_1 = _mm256_setzero_si256();
+
+	for (int g = 0; g < groups; g++)
+	{
+		__m256i a256 = unpack8(column, &table, g);
+		sum256_0 = _mm256_add_epi64(sum256_0, _mm256_and_si256(a256, low256));
+		sum256_1 = _mm256_add_epi64(sum256_1, _mm256_srli_epi64(a256, 32));
+	}
+
+	// base ͂܂Ƃ߂đB
+	long long sum = horizontal_add_epi64(_mm256_add_epi64(sum256_0, sum256_1)) + (long long)column->base * groups * 8;
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (int i = groups * 8; i < column->length; i++)
+	{
+		sum += packed_column_get(column, i);
+	}
+
+	return sum;
+}
+
+// SIMD ߂gA̒ŏl߂֐B
+int packed_min_of(const packed_column* column)
+{
+	int groups = column->bits <= MAX_SIMD_BITS ? column->length / 8 : 0;
+	unpack_table table = make_unpack_table(column->bits);
+
+	// WJl 0 ȏȂ̂ŁAt̂܂ܔrłB
+	__m256i min_value256 = _mm256_set1_epi32(INT_MAX);
+
+	for (int g = 0; g < groups; g++)
+	{
+		min_value256 = _mm256_min_epi32(min_value256, unpack8(column, &table, g));
+	}
+
+	int result[8];
+	_mm256_storeu_si256((__m256i*)result, min_value256);
+
+	int min_value = INT_MAX;
+
+	if (groups > 0)
+	{
+		min_value = result[0];
+
+		for (int j = 1; j < 8; j++)
+		{
+			min_value = result[j] < min_value ? result[j] : min_value;
+		}
+
+		min_value += column->base;
+	}
+
+	// c̗vfB
+	for (int i = groups * 8; i < column->length; i++)
+	{
+		int value = packed_column_get(column, i);
+		min_value = value < min_value ? value : min_value;
+	}
+
+	return min_value;
+}
+
+// SIMD ߂gA̒ől߂֐B
+int packed_max_of(const packed_column* column)
+{
+	int groups = column->bits <= MAX_SIMD_BITS ? column->length / 8 : 0;
+	unpack_table table = make_unpack_table(column->bits);
+
+	__m256i max_value256 = _mm256_setzero_si256();
+
+	for (int g = 0; g < groups; g++)
+	{
+		max_value256 = _mm256_max_epi32(max_value256, unpack8(column, &table, g));
+	}
+
+	int result[8];
+	_mm256_storeu_si256((__m256i*)result, max_value256);
+
+	int max_value = INT_MIN;
+
+	if (groups > 0)
+	{
+		max_value = result[0];
+
+		for (int j = 1; j < 8; j++)
+		{
+			max_value = result[j] > max_value ? result[j] : max_value;
+		}
+
+		max_value += column->base;
+	}
+
+	// c̗vfB
+	for (int i = groups * 8; i < column->length; i++)
+	{
+		int value = packed_column_get(column, i);
+		max_value = value > max_value ? value : max_value;
+	}
+
+	return max_value;
+}
+
+// SIMD ߂gA̒ key Ɠvf̃CfbNX߂֐B
+int packed_index_of(const packed_column* column, int key)
+{
+	// key  base ̍ɕϊB
+	// Ɋi[łȂlł΁AT܂łȂB
+	unsigned int offset = (unsigned int)key - (unsigned int)column->base;
+
+	if (key < column->base || (column->bits < 32 && offset >= (1u << column->bits)))
+	{
+		return -1;
+	}
+
+	int groups = column->bits <= MAX_SIMD_BITS ? column->length / 8 : 0;
+	unpack_table table = make_unpack_table(column->bits);
+	__m256i key256 = _mm256_set1_epi32((int)offset);
+
+	for (int g = 0; g < groups; g++)
+	{
+		__m256i equals256 = _mm256_cmpeq_epi32(unpack8(column, &table, g), key256);
+
+		// 8 ̗vf̒ key Ɠvf邩ǂ𔻒B
+		if (!_mm256_testz_si256(equals256, equals256))
+		{
+			return g * 8 + find_first_non_zero_index_epi32(equals256);
+		}
+	}
+
+	// c̗vfB
+	for (int i = groups * 8; i < column->length; i++)
+	{
+		if (packed_column_get(column, i) == key)
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+// SIMD ߂gAƔz b ̓ς߂֐B
+// _mm256_mul_epi32 ŋԖڂƊԖڂ̗vf̐ς 64 rbgŋ߂đB
+long long packed_dot_product(const packed_column* column, const int b[])
+{
+	int groups = column->bits <= MAX_SIMD_BITS ? column->length / 8 : 0;
+	unpack_table table = make_unpack_table(column->bits);
+	__m256i base256 = _mm256_set1_epi32(column->base);
+
+	__m256i even256 = _mm256_setzero_si256();
+	__m256i odd256 = _mm256_setzero_si256();
+
+	for (int g = 0; g < groups; g++)
+	{
+		__m256i a256 = _mm256_add_epi32(unpack8(column, &table, g), base256);
+		__m256i b256 = _mm256_loadu_si256((__m256i*)(&b[g * 8]));
+		even256 = _mm256_add_epi64(even256, _mm256_mul_epi32(a256, b256));
+		odd256 = _mm256_add_epi64(odd256, _mm256_mul_epi32(_mm256_srli_epi64(a256, 32), _mm256_srli_epi64(b256, 32)));
+	}
+
+	long long dot_product = horizontal_add_epi64(_mm256_add_epi64(even256, odd256));
+
+	// c̗vfB
+	for (int i = groups * 8; i < column->length; i++)
+	{
+		dot_product += (long long)packed_column_get(column, i) * b[i];
+	}
+
+	return dot_product;
+}
+
+// 8 vf̗ݐϘa߂֐B
+__m256i prefix_sum_epi32(__m256i a256)
+{
+	// 128 rbg[̒ŗݐϘa߂B
+	a256 = _mm256_add_epi32(a256, _mm256_slli_si256(a256, 4));
+	a256 = _mm256_add_epi32(a256, _mm256_slli_si256(a256, 8));
+
+	// ʃ[̍vʃ[ɑB
+	__m256i low_total256 = _mm256_shuffle_epi32(a256, _MM_SHUFFLE(3, 3, 3, 3));
+	low_total256 = _mm256_permute2x128_si256(low_total256, low_total256, 0x08);
+
+	return _mm256_add_epi32(a256, low_total256);
+}
+
+// ėp߂gAꂽ̑Svf̘a߂֐B
+long long delta_sum_general(const delta_column* column)
+{
+	int value = column->first;
+	long long sum = 0;
+
+	for (int i = 0; i < column->deltas.length; i++)
+	{
+		value += packed_column_get(&column->deltas, i);
+		sum += value;
+	}
+
+	return sum;
+}
+
+// SIMD ߂gAꂽ̑Svf̘a߂֐B
+// WJėݐϘaŌ̒lɖ߂A64 rbgɕgčvB
+long long delta_sum(const delta_column* column)
+{
+	const packed_column* deltas = &column->deltas;
+	int groups = deltas->bits <= MAX_SIMD_BITS ? deltas->length / 8 : 0;
+	unpack_table table = make_unpack_table(deltas->bits);
+	__m256i base256 = _mm256_set1_epi32(deltas->base);
+
+	// O̗vf̒lS[ɎB
+	__m256i previous256 = _mm256_set1_epi32(column->first);
+	__m256i sum256 = _mm256_setzero_si256();
+
+	for (int g = 0; g < groups; g++)
+	{
+		__m256i delta256 = _mm256_add_epi32(unpack8(deltas, &table, g), base256);
+		__m256i value256 = _mm256_add_epi32(prefix_sum_epi32(delta256), previous256);
+		sum256 = add_epi32_to_epi64(sum256, value256);
+		previous256 = _mm256_permutevar8x32_epi32(value256, _mm256_set1_epi32(7));
+	}
+
+	long long sum = horizontal_add_epi64(sum256);
+	int value = _mm256_cvtsi256_si32(previous256);
+
+	// c̗vfB
+	for (int i = groups * 8; i < deltas->length; i++)
+	{
+		value += packed_column_get(deltas, i);
+		sum += value;
+	}
+
+	return sum;
+}
+
+// SIMD ߂gAꂽ̗̒ key Ɠvf̃CfbNX߂֐B
+// key 傫vf_ŒTł؂B
+int delta_index_of(const delta_column* column, int key)
+{
+	const packed_column* deltas = &column->deltas;
+	int groups = deltas->bits <= MAX_SIMD_BITS ? deltas->length / 8 : 0;
+	unpack_table table = make_unpack_table(deltas->bits);
+	__m256i base256 = _mm256_set1_epi32(deltas->base);
+	__m256i key256 = _mm256_set1_epi32(key);
+
+	__m256i previous256 = _mm256_set1_epi32(column->first);
+
+	for (int g = 0; g < groups; g++)
+	{
+		__m256i delta256 = _mm256_add_epi32(unpack8(deltas, &table, g), base256);
+		__m256i value256 = _mm256_add_epi32(prefix_sum_epi32(delta256), previous256);
+		__m256i equals256 = _mm256_cmpeq_epi32(value256, key256);
+
+		if (!_mm256_testz_si256(equals256, equals256))
+		{
+			return g * 8 + find_first_non_zero_index_epi32(equals256);
+		}
+
+		// Ȃ̂ŁAkey 𒴂Ă΂ȍ~ key ͂ȂB
+		__m256i greater256 = _mm256_cmpgt_epi32(value256, key256);
+
+		if (!_mm256_testz_si256(greater256, greater256))
+		{
+			return -1;
+		}
+
+		previous256 = _mm256_permutevar8x32_epi32(value256, _mm256_set1_epi32(7));
+	}
+
+	int value = _mm256_cvtsi256_si32(previous256);
+
+	// c̗vfB
+	for (int i = groups * 8; i < deltas->length; i++)
+	{
+		value += packed_column_get(deltas, i);
+
+		if (value == key)
+		{
+			return i;
+		}
+
+		if (value > key)
+		{
+			return -1;
+		}
+	}
+
+	return -1;
+}
+
+int main(void)
+{
+	// 1000  100999 ܂ł̒lBŏl 0  99999i17 rbgjɂȂB
+	int length = 1 << 22;
+	int* a = (int*)malloc(sizeof(int) * length);
+	int* b = (int*)malloc(sizeof(int) * length);
+	int* timestamps = (int*)malloc(sizeof(int) * length);
+
+	if (a == NULL || b == NULL || timestamps == NULL)
+	{
+		free(a);
+		free(b);
+		free(timestamps);
+		return 1;
+	}
+
+	srand(1);
+
+	for (int i = 0; i < length; i++)
+	{
+		// RAND_MAX  32767 ̏nł 17 rbgɓ͂悤ɁA2 񕪂̗gݍ킹B
+		a[i] = 1000 + (int)((((unsigned int)rand() << 16) ^ (unsigned int)rand()) % 100000);
+		b[i] = rand() % 10;
+		timestamps[i] = 1700000000 + i * 3 + rand() % 3;
+	}
+
+	packed_column column = packed_column_create(a, length);
+	delta_column delta = delta_column_create(timestamps, length);
+
+	printf("packed_column: %d bits, %zu bytes (int[]: %zu bytes)\n",
+		column.bits, ((size_t)length * column.bits + 7) / 8, sizeof(int) * length);
+	printf("delta_column:  %d bits, %zu bytes (int[]: %zu bytes)\n\n",
+		delta.deltas.bits, ((size_t)length * delta.deltas.bits + 7) / 8, sizeof(int) * length);
+
+	// ̔zɑ΂ėp߂̌ʂƔrB
+	long long expected_sum = 0;
+	long long expected_dot_product = 0;
+	long long expected_timestamp_sum = 0;
+
+	for (int i = 0; i < length; i++)
+	{
+		expected_sum += a[i];
+		expected_dot_product += (long long)a[i] * b[i];
+		expected_timestamp_sum += timestamps[i];
+	}
+
+	clock_t start = clock();
+	long long result = packed_sum_general(&column);
+	printf("packed_sum_general: %lld (%ld ms)\n", result, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	result = packed_sum(&column);
+	printf("packed_sum:         %lld (%ld ms)\n", result, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+	printf("expected:           %lld\n\n", expected_sum);
+
+	printf("packed_min_of:      %d\n", packed_min_of(&column));
+	printf("packed_max_of:      %d\n", packed_max_of(&column));
+	printf("packed_index_of:    %d (a[%d] = %d)\n", packed_index_of(&column, a[12345]), 12345, a[12345]);
+	printf("packed_dot_product: %lld (expected %lld)\n\n", packed_dot_product(&column, b), expected_dot_product);
+
+	start = clock();
+	result = delta_sum_general(&delta);
+	printf("delta_sum_general:  %lld (%ld ms)\n", result, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	result = delta_sum(&delta);
+	printf("delta_sum:          %lld (%ld ms)\n", result, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+	printf("expected:           %lld\n\n", expected_timestamp_sum);
+
+	printf("delta_index_of:     %d (timestamps[%d] = %d)\n", delta_index_of(&delta, timestamps[987654]), 987654, timestamps[987654]);
+	printf("delta_index_of:     %d (missing key)\n", delta_index_of(&delta, timestamps[length - 1] + 1));
+
+	packed_column_free(&column);
+	packed_column_free(&delta.deltas);
+	free(a);
+	free(b);
+	free(timestamps);
+
+	return 0;
+}
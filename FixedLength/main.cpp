@@ -0,0 +1,329 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdio.h>
+#include <limits.h>
+#include <time.h>
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include <intrin.h>
+
+// vfRpCɌ܂ĂZxNg̊֐̃TvB
+// vf N ev[gɂƁA[vc̗vf̏SēWJA
+// 8  256 rbgAc 4  128 rbgAȉ͔ėp߂ƁAKvȕ̖߂cB
+
+// 256 rbgA128 rbgAėp߂ŏvf̐B
+template <std::size_t N>
+struct fixed_length
+{
+	static constexpr std::size_t blocks256 = N / 8;
+	static constexpr std::size_t offset128 = blocks256 * 8;
+	static constexpr std::size_t blocks128 = (N % 8) / 4;
+	static constexpr std::size_t offset_rest = offset128 + blocks128 * 4;
+	static constexpr std::size_t rest = N % 4;
+};
+
+// 4 ̗vf̘a߂֐B
+// ̂Ȃ shuffle  add ŋ߂B
+inline int reduce_add_epi32(__m128i a128)
+{
+	a128 = _mm_add_epi32(a128, _mm_shuffle_epi32(a128, _MM_SHUFFLE(1, 0, 3, 2)));
+	a128 = _mm_add_epi32(a128, _mm_shuffle_epi32(a128, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtsi128_si32(a128);
+}
+
+inline __m128i fold_add_epi32(__m256i a256)
+{
+	return _mm_add_epi32(_mm256_castsi256_si128(a256), _mm256_extracti128_si256(a256, 1));
+}
+
+inline int reduce_min_epi32(__m128i a128)
+{
+	a128 = _mm_min_epi32(a128, _mm_shuffle_epi32(a128, _MM_SHUFFLE(1, 0, 3, 2)));
+	a128 = _mm_min_epi32(a128, _mm_shuffle_epi32(a128, _MM_SHUFFLE(2, 3, 0, 1)));
+	return _mm_cvtsi128_si32(a128);
+}
+
+inline __m128i fold_min_epi32(__m256i a256)
+{
+	return _mm_min_epi32(_mm256_castsi256_si128(a256), _mm256_extracti128_si256(a256, 1));
+}
+
+inline float reduce_add_ps(__m128 a128)
+{
+	a128 = _mm_add_ps(a128, _mm_movehl_ps(a128, a128));
+	a128 = _mm_add_ss(a128, _mm_shuffle_ps(a128, a128, _MM_SHUFFLE(1, 1, 1, 1)));
+	return _mm_cvtss_f32(a128);
+}
+
+inline __m128 fold_add_ps(__m256 a256)
+{
+	return _mm_add_ps(_mm256_castps256_ps128(a256), _mm256_extractf128_ps(a256, 1));
+}
+
+// z a ̘a߂֐́AvfƂɓWJ镔B
+// I...  0 n܂AԂŁAݍݎ 1 ߂ɓWJB
+template <std::size_t N, std::size_t... I, std::size_t... J, std::size_t... K>
+inline int sum(const int* a, std::index_sequence<I...>, std::index_sequence<J...>, std::index_sequence<K...>)
+{
+	using length = fixed_length<N>;
+
+	__m256i sum256 = _mm256_setzero_si256();
+	((sum256 = _mm256_add_epi32(sum256, _mm256_loadu_si256((const __m256i*)(&a[I * 8])))), ...);
+
+	__m128i sum128 = fold_add_epi32(sum256);
+	((sum128 = _mm_add_epi32(sum128, _mm_loadu_si128((const __m128i*)(&a[length::offset128 + J * 4])))), ...);
+
+	int sum = reduce_add_epi32(sum128);
+	((sum += a[length::offset_rest + K]), ...);
+
+	return sum;
+}
+
+// SIMD ߂gAvf N ̔z a ̘a߂֐B
+template <std::size_t N>
+inline int sum(const int* a)
+{
+	using length = fixed_length<N>;
+
+	return sum<N>(a,
+		std::make_index_sequence<length::blocks256>(),
+		std::make_index_sequence<length::blocks128>(),
+		std::make_index_sequence<length::rest>());
+}
+
+template <std::size_t N>
+inline int sum(const int (&a)[N])
+{
+	return sum<N>(&a[0]);
+}
+
+template <std::size_t N, std::size_t... I, std::size_t... J, std::size_t... K>
+inline int dot_product(const int* a, const int* b, std::index_sequence<I...>, std::index_sequence<J...>, std::index_sequence<K...>)
+{
+	using length = fixed_length<N>;
+
+	__m256i dot_product256 = _mm256_setzero_si256();
+	((dot_product256 = _mm256_add_epi32(dot_product256, _mm256_mullo_epi32(
+		_mm256_loadu_si256((const __m256i*)(&a[I * 8])),
+		_mm256_loadu_si256((const __m256i*)(&b[I * 8]))))), ...);
+
+	__m128i dot_product128 = fold_add_epi32(dot_product256);
+	((dot_product128 = _mm_add_epi32(dot_product128, _mm_mullo_epi32(
+		_mm_loadu_si128((const __m128i*)(&a[length::offset128 + J * 4])),
+		_mm_loadu_si128((const __m128i*)(&b[length::offset128 + J * 4]))))), ...);
+
+	int dot_product = reduce_add_epi32(dot_product128);
+	((dot_product += a[length::offset_rest + K] * b[length::offset_rest + K]), ...);
+
+	return dot_product;
+}
+
+// SIMD ߂gAvf N ̃xNg̓ς߂֐B
+template <std::size_t N>
+inline int dot_product(const int* a, const int* b)
+{
+	using length = fixed_length<N>;
+
+	return dot_product<N>(a, b,
+		std::make_index_sequence<length::blocks256>(),
+		std::make_index_sequence<length::blocks128>(),
+		std::make_index_sequence<length::rest>());
+}
+
+template <std::size_t N>
+inline int dot_product(const int (&a)[N], const int (&b)[N])
+{
+	return dot_product<N>(&a[0], &b[0]);
+}
+
+template <std::size_t N, std::size_t... I, std::size_t... J, std::size_t... K>
+inline float dot_product(const float* a, const float* b, std::index_sequence<I...>, std::index_sequence<J...>, std::index_sequence<K...>)
+{
+	using length = fixed_length<N>;
+
+	__m256 dot_product256 = _mm256_setzero_ps();
+	((dot_product256 = _mm256_fmadd_ps(_mm256_loadu_ps(&a[I * 8]), _mm256_loadu_ps(&b[I * 8]), dot_product256)), ...);
+
+	__m128 dot_product128 = fold_add_ps(dot_product256);
+	((dot_product128 = _mm_fmadd_ps(
+		_mm_loadu_ps(&a[length::offset128 + J * 4]),
+		_mm_loadu_ps(&b[length::offset128 + J * 4]),
+		dot_product128)), ...);
+
+	float dot_product = reduce_add_ps(dot_product128);
+	((dot_product += a[length::offset_rest + K] * b[length::offset_rest + K]), ...);
+
+	return dot_product;
+}
+
+// SIMD ߂gAvf N ̕_̃xNg̓ς߂֐B
+template <std::size_t N>
+inline float dot_product(const float* a, const float* b)
+{
+	using length = fixed_length<N>;
+
+	return dot_product<N>(a, b,
+		std::make_index_sequence<length::blocks256>(),
+		std::make_index_sequence<length::blocks128>(),
+		std::make_index_sequence<length::rest>());
+}
+
+template <std::size_t N>
+inline float dot_product(const float (&a)[N], const float (&b)[N])
+{
+	return dot_product<N>(&a[0], &b[0]);
+}
+
+template <std::size_t N, std::size_t... I, std::size_t... J, std::size_t... K>
+inline int min_of(const int* a, std::index_sequence<I...>, std::index_sequence<J...>, std::index_sequence<K...>)
+{
+	using length = fixed_length<N>;
+
+	__m256i min_value256 = _mm256_set1_epi32(INT_MAX);
+	((min_value256 = _mm256_min_epi32(min_value256, _mm256_loadu_si256((const __m256i*)(&a[I * 8])))), ...);
+
+	__m128i min_value128 = fold_min_epi32(min_value256);
+	((min_value128 = _mm_min_epi32(min_value128, _mm_loadu_si128((const __m128i*)(&a[length::offset128 + J * 4])))), ...);
+
+	int min_value = reduce_min_epi32(min_value128);
+	((min_value = a[length::offset_rest + K] < min_value ? a[length::offset_rest + K] : min_value), ...);
+
+	return min_value;
+}
+
+// SIMD ߂gAvf N ̔z a ̒ŏl߂֐B
+template <std::size_t N>
+inline int min_of(const int* a)
+{
+	using length = fixed_length<N>;
+
+	return min_of<N>(a,
+		std::make_index_sequence<length::blocks256>(),
+		std::make_index_sequence<length::blocks128>(),
+		std::make_index_sequence<length::rest>());
+}
+
+template <std::size_t N>
+inline int min_of(const int (&a)[N])
+{
+	return min_of<N>(&a[0]);
+}
+
+// vf N ̃xNg count g񂾔z a  b ɂāAgƂ̓ς result ɏފ֐B
+// i gڂ̃xNg a[i * N] n܂B
+// ς̊֐͓WJă[v̒ɓ̂ŁAĂяõRXgȂB
+template <std::size_t N, typename T>
+void dot_product_batch(const T* a, const T* b, int count, T result[])
+{
+	for (int i = 0; i < count; i++)
+	{
+		result[i] = dot_product<N>(&a[i * N], &b[i * N]);
+	}
+}
+
+// ėp߂gAxNg̓ς߂֐B
+int dot_product_general(const int a[], const int b[], int length)
+{
+	int dot_product = 0;
+
+	for (int i = 0; i < length; i++)
+	{
+		dot_product += a[i] * b[i];
+	}
+
+	return dot_product;
+}
+
+// SIMD ߂gAvfsɌ܂xNg̓ς߂֐B
+// VectorDotProduct ƓB
+int dot_product(const int a[], const int b[], int length)
+{
+	int i = 0;
+
+	__m256i dot_product256 = _mm256_setzero_si256();
+
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i b256 = _mm256_loadu_si256((__m256i*)(&b[i]));
+
+		__m256i product256 = _mm256_mullo_epi32(a256, b256);
+		dot_product256 = _mm256_add_epi32(dot_product256, product256);
+	}
+
+	__m256i dot_product256_permute = _mm256_permute2x128_si256(dot_product256, dot_product256, 1);
+	__m256i sum256 = _mm256_hadd_epi32(dot_product256, dot_product256_permute);
+	sum256 = _mm256_hadd_epi32(sum256, sum256);
+	sum256 = _mm256_hadd_epi32(sum256, sum256);
+	int dot_product = _mm256_extract_epi32(sum256, 0);
+
+	for (; i < length; i++)
+	{
+		dot_product += a[i] * b[i];
+	}
+
+	return dot_product;
+}
+
+int main(void)
+{
+	int a[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	int b[] = { 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+	int c[] = { 5, -3, 8, 1, 12, 7, -6, 4, 9, 2, 11, 0 };
+	float x[] = { 0.5f, 1.0f, 1.5f };
+	float y[] = { 2.0f, 4.0f, 6.0f };
+
+	printf("dot_product_general(a, b, 9) = %d\n", dot_product_general(a, b, 9));
+	printf("dot_product(a, b, 9)         = %d\n", dot_product(a, b, 9));
+	printf("dot_product<9>(a, b)         = %d\n", dot_product<9>(a, b));
+	printf("sum<12>(c)                   = %d\n", sum(c));
+	printf("min_of<12>(c)                = %d\n", min_of(c));
+	printf("dot_product<3>(x, y)         = %f\n", dot_product(x, y));
+
+	// ZxNg̓ς񋁂߂āAxrB
+	// LbVɎ܂傫ɂāAvZȊO̎ԂB
+	// 12 vf̃xNg 4096 g 2000 񋁂߂ƂAdot_product_batch<12>  1.5  1.9 {قǑB
+	const int count = 1 << 12;
+	const int length = 12;
+	std::vector<int> large_a(count * length);
+	std::vector<int> large_b(count * length);
+	std::vector<int> result(count);
+
+	for (int i = 0; i < count * length; i++)
+	{
+		large_a[i] = i % 100;
+		large_b[i] = i % 7;
+	}
+
+	long long total = 0;
+	clock_t start = clock();
+
+	for (int repeat = 0; repeat < 2000; repeat++)
+	{
+		for (int i = 0; i < count; i++)
+		{
+			result[i] = dot_product(&large_a[i * length], &large_b[i * length], length);
+		}
+
+		total += result[count - 1];
+	}
+
+	clock_t runtime_length_time = clock() - start;
+	printf("\ndot_product(a, b, 12):       %lld (%ld ms)\n", total, (long)(runtime_length_time * 1000 / CLOCKS_PER_SEC));
+
+	total = 0;
+	start = clock();
+
+	for (int repeat = 0; repeat < 2000; repeat++)
+	{
+		dot_product_batch<length>(large_a.data(), large_b.data(), count, result.data());
+		total += result[count - 1];
+	}
+
+	clock_t batch_time = clock() - start;
+	printf("dot_product_batch<12>:       %lld (%ld ms, %.2fx)\n", total, (long)(batch_time * 1000 / CLOCKS_PER_SEC), (double)runtime_length_time / (batch_time > 0 ? batch_time : 1));
+
+	return 0;
+}
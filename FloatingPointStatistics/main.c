@@ -0,0 +1,1027 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
+#include <intrin.h>
+
+// _̕UAUA֌W߂TvB
+// SāA炵f[^ d = x - shift ̘aƓa狁߂B
+// shift 𕽋ςɋ߂lɂƁAE[x^2] - E[x]^2 ̈ZŌ̂hB
+
+// ۂߌ덷␳Ȃ瑫B
+#define STATISTICS_COMPENSATED 1
+
+// 1 ڂŕς߁A2 ڂŕς̍𑫂B
+// w肵Ȃꍇ́Aŏ̗vf炵 1 ŋ߂B
+#define STATISTICS_TWO_PASS 2
+
+// 炵f[^̘aB
+// b gȂꍇAsum_bAsum_bbAsum_ab  0 ɂȂB
+typedef struct
+{
+	double sum_a;
+	double sum_b;
+	double sum_aa;
+	double sum_bb;
+	double sum_ab;
+} moments;
+
+// aƓa番U߂֐B
+double variance_from_sums(double sum, double squared_sum, int length)
+{
+	return (squared_sum - sum * sum / length) / length;
+}
+
+// aƐϘa狤U߂֐B
+double covariance_from_sums(double sum_a, double sum_b, double sum_ab, int length)
+{
+	return (sum_ab - sum_a * sum_b / length) / length;
+}
+
+// ėp߂gANeumaier ̕@ s  x 𑫂֐B
+// ƂɎꂽʂ̌ c ɒ߂B
+void neumaier_add(double* s, double* c, double x)
+{
+	double t = *s + x;
+
+	if (fabs(*s) >= fabs(x))
+	{
+		*c += (*s - t) + x;
+	}
+	else
+	{
+		*c += (x - t) + *s;
+	}
+
+	*s = t;
+}
+
+// ėp߂gAx * y 덷Ȃ s ɑ֐B
+// ς̊ۂߌ덷 FMA ŋ߂B
+void neumaier_add_product(double* s, double* c, double x, double y)
+{
+	double p = x * y;
+	neumaier_add(s, c, p);
+	*c += fma(x, y, -p);
+}
+
+// 4 ̗vf̘a߂֐B
+double reduce_add_pd(__m256d a256)
+{
+	__m128d a128 = _mm_add_pd(_mm256_castpd256_pd128(a256), _mm256_extractf128_pd(a256, 1));
+	a128 = _mm_add_sd(a128, _mm_unpackhi_pd(a128, a128));
+	return _mm_cvtsd_f64(a128);
+}
+
+// SIMD ߂gAs  x 𑫂Aꂽʂ̌ c ɒ߂֐B
+// Neumaier ̕@̂悤 |s|  |x| ׂɁAr̗vȂ TwoSum Ō덷߂B
+// ߐȂAblend gȂ̂őB
+void compensated_add_pd(__m256d* s, __m256d* c, __m256d x)
+{
+	__m256d t = _mm256_add_pd(*s, x);
+	__m256d z = _mm256_sub_pd(t, *s);
+	__m256d error = _mm256_add_pd(_mm256_sub_pd(*s, _mm256_sub_pd(t, z)), _mm256_sub_pd(x, z));
+
+	*c = _mm256_add_pd(*c, error);
+	*s = t;
+}
+
+// SIMD ߂gAx * y 덷Ȃ s ɑ֐B
+void compensated_add_product_pd(__m256d* s, __m256d* c, __m256d x, __m256d y)
+{
+	__m256d p = _mm256_mul_pd(x, y);
+	compensated_add_pd(s, c, p);
+	*c = _mm256_add_pd(*c, _mm256_fmsub_pd(x, y, p));
+}
+
+// ␳t 4 ̘aA␳t̃XJ[lɂ܂Ƃ߂֐B
+void reduce_neumaier_pd(__m256d s256, __m256d c256, double* s, double* c)
+{
+	double s4[4];
+	_mm256_storeu_pd(s4, s256);
+
+	*s = 0.0;
+	*c = reduce_add_pd(c256);
+
+	for (int j = 0; j < 4; j++)
+	{
+		neumaier_add(s, c, s4[j]);
+	}
+}
+
+// SIMD ߂gA炵f[^̘a߂֐B
+// Z̑҂ԂB߁A̗ݐςgB
+void moments_fast_pd(const double a[], const double b[], int length, double shift_a, double shift_b, moments* result)
+{
+	__m256d shift_a256 = _mm256_set1_pd(shift_a);
+	__m256d shift_b256 = _mm256_set1_pd(shift_b);
+
+	int i = 0;
+
+	if (b == NULL)
+	{
+		__m256d sum0 = _mm256_setzero_pd();
+		__m256d sum1 = _mm256_setzero_pd();
+		__m256d sum2 = _mm256_setzero_pd();
+		__m256d sum3 = _mm256_setzero_pd();
+		__m256d squared_sum0 = _mm256_setzero_pd();
+		__m256d squared_sum1 = _mm256_setzero_pd();
+		__m256d squared_sum2 = _mm256_setzero_pd();
+		__m256d squared_sum3 = _mm256_setzero_pd();
+
+		// evf 16 B
+		for (; i + 15 < length; i += 16)
+		{
+			__m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 0]), shift_a256);
+			__m256d d1 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 4]), shift_a256);
+			__m256d d2 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 8]), shift_a256);
+			__m256d d3 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 12]), shift_a256);
+
+			sum0 = _mm256_add_pd(sum0, d0);
+			sum1 = _mm256_add_pd(sum1, d1);
+			sum2 = _mm256_add_pd(sum2, d2);
+			sum3 = _mm256_add_pd(sum3, d3);
+
+			squared_sum0 = _mm256_fmadd_pd(d0, d0, squared_sum0);
+			squared_sum1 = _mm256_fmadd_pd(d1, d1, squared_sum1);
+			squared_sum2 = _mm256_fmadd_pd(d2, d2, squared_sum2);
+			squared_sum3 = _mm256_fmadd_pd(d3, d3, squared_sum3);
+		}
+
+		for (; i + 3 < length; i += 4)
+		{
+			__m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(&a[i]), shift_a256);
+			sum0 = _mm256_add_pd(sum0, d0);
+			squared_sum0 = _mm256_fmadd_pd(d0, d0, squared_sum0);
+		}
+
+		result->sum_a = reduce_add_pd(_mm256_add_pd(_mm256_add_pd(sum0, sum1), _mm256_add_pd(sum2, sum3)));
+		result->sum_aa = reduce_add_pd(_mm256_add_pd(_mm256_add_pd(squared_sum0, squared_sum1), _mm256_add_pd(squared_sum2, squared_sum3)));
+		result->sum_b = 0.0;
+		result->sum_bb = 0.0;
+		result->sum_ab = 0.0;
+	}
+	else
+	{
+		__m256d sum_a0 = _mm256_setzero_pd();
+		__m256d sum_a1 = _mm256_setzero_pd();
+		__m256d sum_b0 = _mm256_setzero_pd();
+		__m256d sum_b1 = _mm256_setzero_pd();
+		__m256d sum_aa0 = _mm256_setzero_pd();
+		__m256d sum_aa1 = _mm256_setzero_pd();
+		__m256d sum_bb0 = _mm256_setzero_pd();
+		__m256d sum_bb1 = _mm256_setzero_pd();
+		__m256d sum_ab0 = _mm256_setzero_pd();
+		__m256d sum_ab1 = _mm256_setzero_pd();
+
+		// evf 8 B
+		for (; i + 7 < length; i += 8)
+		{
+			__m256d da0 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 0]), shift_a256);
+			__m256d da1 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 4]), shift_a256);
+			__m256d db0 = _mm256_sub_pd(_mm256_loadu_pd(&b[i + 0]), shift_b256);
+			__m256d db1 = _mm256_sub_pd(_mm256_loadu_pd(&b[i + 4]), shift_b256);
+
+			sum_a0 = _mm256_add_pd(sum_a0, da0);
+			sum_a1 = _mm256_add_pd(sum_a1, da1);
+			sum_b0 = _mm256_add_pd(sum_b0, db0);
+			sum_b1 = _mm256_add_pd(sum_b1, db1);
+
+			sum_aa0 = _mm256_fmadd_pd(da0, da0, sum_aa0);
+			sum_aa1 = _mm256_fmadd_pd(da1, da1, sum_aa1);
+			sum_bb0 = _mm256_fmadd_pd(db0, db0, sum_bb0);
+			sum_bb1 = _mm256_fmadd_pd(db1, db1, sum_bb1);
+			sum_ab0 = _mm256_fmadd_pd(da0, db0, sum_ab0);
+			sum_ab1 = _mm256_fmadd_pd(da1, db1, sum_ab1);
+		}
+
+		for (; i + 3 < length; i += 4)
+		{
+			__m256d da0 = _mm256_sub_pd(_mm256_loadu_pd(&a[i]), shift_a256);
+			__m256d db0 = _mm256_sub_pd(_mm256_loadu_pd(&b[i]), shift_b256);
+
+			sum_a0 = _mm256_add_pd(sum_a0, da0);
+			sum_b0 = _mm256_add_pd(sum_b0, db0);
+			sum_aa0 = _mm256_fmadd_pd(da0, da0, sum_aa0);
+			sum_bb0 = _mm256_fmadd_pd(db0, db0, sum_bb0);
+			sum_ab0 = _mm256_fmadd_pd(da0, db0, sum_ab0);
+		}
+
+		result->sum_a = reduce_add_pd(_mm256_add_pd(sum_a0, sum_a1));
+		result->sum_b = reduce_add_pd(_mm256_add_pd(sum_b0, sum_b1));
+		result->sum_aa = reduce_add_pd(_mm256_add_pd(sum_aa0, sum_aa1));
+		result->sum_bb = reduce_add_pd(_mm256_add_pd(sum_bb0, sum_bb1));
+		result->sum_ab = reduce_add_pd(_mm256_add_pd(sum_ab0, sum_ab1));
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		double da = a[i] - shift_a;
+		result->sum_a += da;
+		result->sum_aa += da * da;
+
+		if (b != NULL)
+		{
+			double db = b[i] - shift_b;
+			result->sum_b += db;
+			result->sum_bb += db * db;
+			result->sum_ab += da * db;
+		}
+	}
+}
+
+// SIMD ߂gA炵f[^̘aAۂߌ덷␳Ȃ狁߂֐B
+// ␳t̑Z͑҂Ԃ̂ŁAaƕ␳̑g𕡐Ĉˑ֌Wf؂B
+void moments_compensated_pd(const double a[], const double b[], int length, double shift_a, double shift_b, moments* result)
+{
+	__m256d shift_a256 = _mm256_set1_pd(shift_a);
+	__m256d shift_b256 = _mm256_set1_pd(shift_b);
+	__m256d zero256 = _mm256_setzero_pd();
+
+	__m256d sum_a = zero256, error_a = zero256;
+	__m256d sum_b = zero256, error_b = zero256;
+	__m256d sum_aa = zero256, error_aa = zero256;
+	__m256d sum_bb = zero256, error_bb = zero256;
+	__m256d sum_ab = zero256, error_ab = zero256;
+
+	int i = 0;
+
+	if (b == NULL)
+	{
+		// ׂ荇 4 ̃xNg𕁒ʂɑĂA␳tőB
+		// ʂɑƂ̊ۂߌ덷͊evf̑傫̐{  Ɏ܂Avfɂ͔ႵȂB
+		// ␳t̑Z̉񐔂 4  1 ɂȂ̂ŁA␳Ȃ SIMD łɋ߂ɂȂB
+		// a 2 gɕāAZ̑҂ԂBB
+		__m256d sum_a1 = zero256, error_a1 = zero256;
+		__m256d sum_aa1 = zero256, error_aa1 = zero256;
+
+		// evf 32 B
+		for (; i + 31 < length; i += 32)
+		{
+			__m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 0]), shift_a256);
+			__m256d d1 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 4]), shift_a256);
+			__m256d d2 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 8]), shift_a256);
+			__m256d d3 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 12]), shift_a256);
+			__m256d d4 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 16]), shift_a256);
+			__m256d d5 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 20]), shift_a256);
+			__m256d d6 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 24]), shift_a256);
+			__m256d d7 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 28]), shift_a256);
+
+			compensated_add_pd(&sum_a, &error_a, _mm256_add_pd(_mm256_add_pd(d0, d1), _mm256_add_pd(d2, d3)));
+			compensated_add_pd(&sum_a1, &error_a1, _mm256_add_pd(_mm256_add_pd(d4, d5), _mm256_add_pd(d6, d7)));
+			compensated_add_pd(&sum_aa, &error_aa, _mm256_add_pd(_mm256_fmadd_pd(d0, d0, _mm256_mul_pd(d1, d1)), _mm256_fmadd_pd(d2, d2, _mm256_mul_pd(d3, d3))));
+			compensated_add_pd(&sum_aa1, &error_aa1, _mm256_add_pd(_mm256_fmadd_pd(d4, d4, _mm256_mul_pd(d5, d5)), _mm256_fmadd_pd(d6, d6, _mm256_mul_pd(d7, d7))));
+		}
+
+		// g 1 ɂ܂Ƃ߂B
+		// aǂ␳tőB
+		compensated_add_pd(&sum_a, &error_a, sum_a1);
+		compensated_add_pd(&sum_aa, &error_aa, sum_aa1);
+		error_a = _mm256_add_pd(error_a, error_a1);
+		error_aa = _mm256_add_pd(error_aa, error_aa1);
+
+		for (; i + 3 < length; i += 4)
+		{
+			__m256d d0 = _mm256_sub_pd(_mm256_loadu_pd(&a[i]), shift_a256);
+			compensated_add_pd(&sum_a, &error_a, d0);
+			compensated_add_product_pd(&sum_aa, &error_aa, d0, d0);
+		}
+	}
+	else
+	{
+		// 1 głAZ̑҂Ԃ 1 ̏̂̕ŁAg͕ȂB
+		// evf 16 B
+		for (; i + 15 < length; i += 16)
+		{
+			__m256d da0 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 0]), shift_a256);
+			__m256d da1 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 4]), shift_a256);
+			__m256d da2 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 8]), shift_a256);
+			__m256d da3 = _mm256_sub_pd(_mm256_loadu_pd(&a[i + 12]), shift_a256);
+			__m256d db0 = _mm256_sub_pd(_mm256_loadu_pd(&b[i + 0]), shift_b256);
+			__m256d db1 = _mm256_sub_pd(_mm256_loadu_pd(&b[i + 4]), shift_b256);
+			__m256d db2 = _mm256_sub_pd(_mm256_loadu_pd(&b[i + 8]), shift_b256);
+			__m256d db3 = _mm256_sub_pd(_mm256_loadu_pd(&b[i + 12]), shift_b256);
+
+			compensated_add_pd(&sum_a, &error_a, _mm256_add_pd(_mm256_add_pd(da0, da1), _mm256_add_pd(da2, da3)));
+			compensated_add_pd(&sum_b, &error_b, _mm256_add_pd(_mm256_add_pd(db0, db1), _mm256_add_pd(db2, db3)));
+			compensated_add_pd(&sum_aa, &error_aa, _mm256_add_pd(_mm256_fmadd_pd(da0, da0, _mm256_mul_pd(da1, da1)), _mm256_fmadd_pd(da2, da2, _mm256_mul_pd(da3, da3))));
+			compensated_add_pd(&sum_bb, &error_bb, _mm256_add_pd(_mm256_fmadd_pd(db0, db0, _mm256_mul_pd(db1, db1)), _mm256_fmadd_pd(db2, db2, _mm256_mul_pd(db3, db3))));
+			compensated_add_pd(&sum_ab, &error_ab, _mm256_add_pd(_mm256_fmadd_pd(da0, db0, _mm256_mul_pd(da1, db1)), _mm256_fmadd_pd(da2, db2, _mm256_mul_pd(da3, db3))));
+		}
+
+		for (; i + 3 < length; i += 4)
+		{
+			__m256d da0 = _mm256_sub_pd(_mm256_loadu_pd(&a[i]), shift_a256);
+			__m256d db0 = _mm256_sub_pd(_mm256_loadu_pd(&b[i]), shift_b256);
+
+			compensated_add_pd(&sum_a, &error_a, da0);
+			compensated_add_pd(&sum_b, &error_b, db0);
+			compensated_add_product_pd(&sum_aa, &error_aa, da0, da0);
+			compensated_add_product_pd(&sum_bb, &error_bb, db0, db0);
+			compensated_add_product_pd(&sum_ab, &error_ab, da0, db0);
+		}
+	}
+
+	double s[5];
+	double c[5];
+
+	reduce_neumaier_pd(sum_a, error_a, &s[0], &c[0]);
+	reduce_neumaier_pd(sum_b, error_b, &s[1], &c[1]);
+	reduce_neumaier_pd(sum_aa, error_aa, &s[2], &c[2]);
+	reduce_neumaier_pd(sum_bb, error_bb, &s[3], &c[3]);
+	reduce_neumaier_pd(sum_ab, error_ab, &s[4], &c[4]);
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		double da = a[i] - shift_a;
+		neumaier_add(&s[0], &c[0], da);
+		neumaier_add_product(&s[2], &c[2], da, da);
+
+		if (b != NULL)
+		{
+			double db = b[i] - shift_b;
+			neumaier_add(&s[1], &c[1], db);
+			neumaier_add_product(&s[3], &c[3], db, db);
+			neumaier_add_product(&s[4], &c[4], da, db);
+		}
+	}
+
+	result->sum_a = s[0] + c[0];
+	result->sum_b = s[1] + c[1];
+	result->sum_aa = s[2] + c[2];
+	result->sum_bb = s[3] + c[3];
+	result->sum_ab = s[4] + c[4];
+}
+
+// z a  biNULL ł悢jAw肵@ł炵a߂֐B
+void moments_pd(const double a[], const double b[], int length, int options, moments* result)
+{
+	int compensated = options & STATISTICS_COMPENSATED;
+
+	// ŏ̗vfł炷łAl̑傫ϒxLxɉB
+	double shift_a = a[0];
+	double shift_b = b != NULL ? b[0] : 0.0;
+
+	if (options & STATISTICS_TWO_PASS)
+	{
+		// 1 ڂŕς߁A2 ڂ͕ςł炷B
+		if (compensated)
+		{
+			moments_compensated_pd(a, b, length, shift_a, shift_b, result);
+		}
+		else
+		{
+			moments_fast_pd(a, b, length, shift_a, shift_b, result);
+		}
+
+		shift_a += result->sum_a / length;
+		shift_b += result->sum_b / length;
+	}
+
+	if (compensated)
+	{
+		moments_compensated_pd(a, b, length, shift_a, shift_b, result);
+	}
+	else
+	{
+		moments_fast_pd(a, b, length, shift_a, shift_b, result);
+	}
+}
+
+// ėp߂gAz a ̕U߂֐B
+// ArrayDispersion ƓA̕ς畽ς̓B
+double dispersion_general_pd(const double a[], int length)
+{
+	double sum = 0.0;
+	double squared_sum = 0.0;
+
+	for (int i = 0; i < length; i++)
+	{
+		sum += a[i];
+		squared_sum += a[i] * a[i];
+	}
+
+	double average = sum / length;
+	double squared_average = squared_sum / length;
+
+	return squared_average - (average * average);
+}
+
+// SIMD ߂gAz a ̕U߂֐B
+// options  STATISTICS_COMPENSATED  STATISTICS_TWO_PASS ̑gݍ킹B
+double dispersion_pd(const double a[], int length, int options)
+{
+	if (length <= 0)
+	{
+		return NAN;
+	}
+
+	moments m;
+	moments_pd(a, NULL, length, options, &m);
+
+	return variance_from_sums(m.sum_a, m.sum_aa, length);
+}
+
+// SIMD ߂gA炳ɓ̕ς畽ς̓ĕU߂֐B
+// xׂ邽߂̊ŁAςL傫ƌB
+double dispersion_naive_pd(const double a[], int length)
+{
+	__m256d sum0 = _mm256_setzero_pd();
+	__m256d sum1 = _mm256_setzero_pd();
+	__m256d sum2 = _mm256_setzero_pd();
+	__m256d sum3 = _mm256_setzero_pd();
+	__m256d squared_sum0 = _mm256_setzero_pd();
+	__m256d squared_sum1 = _mm256_setzero_pd();
+	__m256d squared_sum2 = _mm256_setzero_pd();
+	__m256d squared_sum3 = _mm256_setzero_pd();
+
+	int i = 0;
+
+	// evf 16 B
+	for (; i + 15 < length; i += 16)
+	{
+		__m256d a0 = _mm256_loadu_pd(&a[i + 0]);
+		__m256d a1 = _mm256_loadu_pd(&a[i + 4]);
+		__m256d a2 = _mm256_loadu_pd(&a[i + 8]);
+		__m256d a3 = _mm256_loadu_pd(&a[i + 12]);
+
+		sum0 = _mm256_add_pd(sum0, a0);
+		sum1 = _mm256_add_pd(sum1, a1);
+		sum2 = _mm256_add_pd(sum2, a2);
+		sum3 = _mm256_add_pd(sum3, a3);
+
+		squared_sum0 = _mm256_fmadd_pd(a0, a0, squared_sum0);
+		squared_sum1 = _mm256_fmadd_pd(a1, a1, squared_sum1);
+		squared_sum2 = _mm256_fmadd_pd(a2, a2, squared_sum2);
+		squared_sum3 = _mm256_fmadd_pd(a3, a3, squared_sum3);
+	}
+
+	double sum = reduce_add_pd(_mm256_add_pd(_mm256_add_pd(sum0, sum1), _mm256_add_pd(sum2, sum3)));
+	double squared_sum = reduce_add_pd(_mm256_add_pd(_mm256_add_pd(squared_sum0, squared_sum1), _mm256_add_pd(squared_sum2, squared_sum3)));
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		sum += a[i];
+		squared_sum += a[i] * a[i];
+	}
+
+	return variance_from_sums(sum, squared_sum, length);
+}
+
+// ėp߂gAz a  b ̋U߂֐B
+double covariance_general_pd(const double a[], const double b[], int length)
+{
+	double multiply_add = 0.0;
+	double sum_a = 0.0;
+	double sum_b = 0.0;
+
+	for (int i = 0; i < length; i++)
+	{
+		multiply_add += a[i] * b[i];
+		sum_a += a[i];
+		sum_b += b[i];
+	}
+
+	double average_multiply = multiply_add / length;
+	double average_a = sum_a / length;
+	double average_b = sum_b / length;
+
+	return average_multiply - (average_a * average_b);
+}
+
+// SIMD ߂gAz a  b ̋U߂֐B
+double covariance_pd(const double a[], const double b[], int length, int options)
+{
+	if (length <= 0)
+	{
+		return NAN;
+	}
+
+	moments m;
+	moments_pd(a, b, length, options, &m);
+
+	return covariance_from_sums(m.sum_a, m.sum_b, m.sum_ab, length);
+}
+
+// ėp߂gAz a  b ̑֌W߂֐B
+double correlation_coefficient_general_pd(const double a[], const double b[], int length)
+{
+	double covariance = covariance_general_pd(a, b, length);
+	double variance_a = dispersion_general_pd(a, length);
+	double variance_b = dispersion_general_pd(b, length);
+
+	return covariance / (sqrt(variance_a) * sqrt(variance_b));
+}
+
+// SIMD ߂gAz a  b ̑֌W߂֐B
+double correlation_coefficient_pd(const double a[], const double b[], int length, int options)
+{
+	if (length <= 0)
+	{
+		return NAN;
+	}
+
+	moments m;
+	moments_pd(a, b, length, options, &m);
+
+	double covariance = covariance_from_sums(m.sum_a, m.sum_b, m.sum_ab, length);
+	double variance_a = variance_from_sums(m.sum_a, m.sum_aa, length);
+	double variance_b = variance_from_sums(m.sum_b, m.sum_bb, length);
+
+	return covariance / (sqrt(variance_a) * sqrt(variance_b));
+}
+
+// 8 ̗vf̘a߂֐B
+double reduce_add_ps(__m256 a256)
+{
+	__m128 a128 = _mm_add_ps(_mm256_castps256_ps128(a256), _mm256_extractf128_ps(a256, 1));
+	a128 = _mm_add_ps(a128, _mm_movehl_ps(a128, a128));
+	a128 = _mm_add_ss(a128, _mm_shuffle_ps(a128, a128, _MM_SHUFFLE(1, 1, 1, 1)));
+	return _mm_cvtss_f32(a128);
+}
+
+void compensated_add_ps(__m256* s, __m256* c, __m256 x)
+{
+	__m256 t = _mm256_add_ps(*s, x);
+	__m256 z = _mm256_sub_ps(t, *s);
+	__m256 error = _mm256_add_ps(_mm256_sub_ps(*s, _mm256_sub_ps(t, z)), _mm256_sub_ps(x, z));
+
+	*c = _mm256_add_ps(*c, error);
+	*s = t;
+}
+
+void compensated_add_product_ps(__m256* s, __m256* c, __m256 x, __m256 y)
+{
+	__m256 p = _mm256_mul_ps(x, y);
+	compensated_add_ps(s, c, p);
+	*c = _mm256_add_ps(*c, _mm256_fmsub_ps(x, y, p));
+}
+
+// ␳t 8 ̘aA{x̕␳t̃XJ[lɂ܂Ƃ߂֐B
+void reduce_neumaier_ps(__m256 s256, __m256 c256, double* s, double* c)
+{
+	float s8[8];
+	_mm256_storeu_ps(s8, s256);
+
+	*s = 0.0;
+	*c = reduce_add_ps(c256);
+
+	for (int j = 0; j < 8; j++)
+	{
+		neumaier_add(s, c, s8[j]);
+	}
+}
+
+// SIMD ߂gA炵Px̃f[^̘a߂֐B
+// a͒Pxő̂ŁAzł STATISTICS_COMPENSATED gƂ悢B
+void moments_fast_ps(const float a[], const float b[], int length, float shift_a, float shift_b, moments* result)
+{
+	__m256 shift_a256 = _mm256_set1_ps(shift_a);
+	__m256 shift_b256 = _mm256_set1_ps(shift_b);
+
+	int i = 0;
+
+	if (b == NULL)
+	{
+		__m256 sum0 = _mm256_setzero_ps();
+		__m256 sum1 = _mm256_setzero_ps();
+		__m256 sum2 = _mm256_setzero_ps();
+		__m256 sum3 = _mm256_setzero_ps();
+		__m256 squared_sum0 = _mm256_setzero_ps();
+		__m256 squared_sum1 = _mm256_setzero_ps();
+		__m256 squared_sum2 = _mm256_setzero_ps();
+		__m256 squared_sum3 = _mm256_setzero_ps();
+
+		// evf 32 B
+		for (; i + 31 < length; i += 32)
+		{
+			__m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 0]), shift_a256);
+			__m256 d1 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 8]), shift_a256);
+			__m256 d2 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 16]), shift_a256);
+			__m256 d3 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 24]), shift_a256);
+
+			sum0 = _mm256_add_ps(sum0, d0);
+			sum1 = _mm256_add_ps(sum1, d1);
+			sum2 = _mm256_add_ps(sum2, d2);
+			sum3 = _mm256_add_ps(sum3, d3);
+
+			squared_sum0 = _mm256_fmadd_ps(d0, d0, squared_sum0);
+			squared_sum1 = _mm256_fmadd_ps(d1, d1, squared_sum1);
+			squared_sum2 = _mm256_fmadd_ps(d2, d2, squared_sum2);
+			squared_sum3 = _mm256_fmadd_ps(d3, d3, squared_sum3);
+		}
+
+		for (; i + 7 < length; i += 8)
+		{
+			__m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(&a[i]), shift_a256);
+			sum0 = _mm256_add_ps(sum0, d0);
+			squared_sum0 = _mm256_fmadd_ps(d0, d0, squared_sum0);
+		}
+
+		result->sum_a = reduce_add_ps(_mm256_add_ps(_mm256_add_ps(sum0, sum1), _mm256_add_ps(sum2, sum3)));
+		result->sum_aa = reduce_add_ps(_mm256_add_ps(_mm256_add_ps(squared_sum0, squared_sum1), _mm256_add_ps(squared_sum2, squared_sum3)));
+		result->sum_b = 0.0;
+		result->sum_bb = 0.0;
+		result->sum_ab = 0.0;
+	}
+	else
+	{
+		__m256 sum_a0 = _mm256_setzero_ps();
+		__m256 sum_a1 = _mm256_setzero_ps();
+		__m256 sum_b0 = _mm256_setzero_ps();
+		__m256 sum_b1 = _mm256_setzero_ps();
+		__m256 sum_aa0 = _mm256_setzero_ps();
+		__m256 sum_aa1 = _mm256_setzero_ps();
+		__m256 sum_bb0 = _mm256_setzero_ps();
+		__m256 sum_bb1 = _mm256_setzero_ps();
+		__m256 sum_ab0 = _mm256_setzero_ps();
+		__m256 sum_ab1 = _mm256_setzero_ps();
+
+		// evf 16 B
+		for (; i + 15 < length; i += 16)
+		{
+			__m256 da0 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 0]), shift_a256);
+			__m256 da1 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 8]), shift_a256);
+			__m256 db0 = _mm256_sub_ps(_mm256_loadu_ps(&b[i + 0]), shift_b256);
+			__m256 db1 = _mm256_sub_ps(_mm256_loadu_ps(&b[i + 8]), shift_b256);
+
+			sum_a0 = _mm256_add_ps(sum_a0, da0);
+			sum_a1 = _mm256_add_ps(sum_a1, da1);
+			sum_b0 = _mm256_add_ps(sum_b0, db0);
+			sum_b1 = _mm256_add_ps(sum_b1, db1);
+
+			sum_aa0 = _mm256_fmadd_ps(da0, da0, sum_aa0);
+			sum_aa1 = _mm256_fmadd_ps(da1, da1, sum_aa1);
+			sum_bb0 = _mm256_fmadd_ps(db0, db0, sum_bb0);
+			sum_bb1 = _mm256_fmadd_ps(db1, db1, sum_bb1);
+			sum_ab0 = _mm256_fmadd_ps(da0, db0, sum_ab0);
+			sum_ab1 = _mm256_fmadd_ps(da1, db1, sum_ab1);
+		}
+
+		for (; i + 7 < length; i += 8)
+		{
+			__m256 da0 = _mm256_sub_ps(_mm256_loadu_ps(&a[i]), shift_a256);
+			__m256 db0 = _mm256_sub_ps(_mm256_loadu_ps(&b[i]), shift_b256);
+
+			sum_a0 = _mm256_add_ps(sum_a0, da0);
+			sum_b0 = _mm256_add_ps(sum_b0, db0);
+			sum_aa0 = _mm256_fmadd_ps(da0, da0, sum_aa0);
+			sum_bb0 = _mm256_fmadd_ps(db0, db0, sum_bb0);
+			sum_ab0 = _mm256_fmadd_ps(da0, db0, sum_ab0);
+		}
+
+		result->sum_a = reduce_add_ps(_mm256_add_ps(sum_a0, sum_a1));
+		result->sum_b = reduce_add_ps(_mm256_add_ps(sum_b0, sum_b1));
+		result->sum_aa = reduce_add_ps(_mm256_add_ps(sum_aa0, sum_aa1));
+		result->sum_bb = reduce_add_ps(_mm256_add_ps(sum_bb0, sum_bb1));
+		result->sum_ab = reduce_add_ps(_mm256_add_ps(sum_ab0, sum_ab1));
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		double da = (double)a[i] - shift_a;
+		result->sum_a += da;
+		result->sum_aa += da * da;
+
+		if (b != NULL)
+		{
+			double db = (double)b[i] - shift_b;
+			result->sum_b += db;
+			result->sum_bb += db * db;
+			result->sum_ab += da * db;
+		}
+	}
+}
+
+// SIMD ߂gA炵Px̃f[^̘aAۂߌ덷␳Ȃ狁߂֐B
+void moments_compensated_ps(const float a[], const float b[], int length, float shift_a, float shift_b, moments* result)
+{
+	__m256 shift_a256 = _mm256_set1_ps(shift_a);
+	__m256 shift_b256 = _mm256_set1_ps(shift_b);
+	__m256 zero256 = _mm256_setzero_ps();
+
+	__m256 sum_a = zero256, error_a = zero256;
+	__m256 sum_b = zero256, error_b = zero256;
+	__m256 sum_aa = zero256, error_aa = zero256;
+	__m256 sum_bb = zero256, error_bb = zero256;
+	__m256 sum_ab = zero256, error_ab = zero256;
+
+	int i = 0;
+
+	if (b == NULL)
+	{
+		// moments_compensated_pd ƓAׂ荇 4 ̃xNg𕁒ʂɑĂA␳tőB
+		// a 2 gɕāAZ̑҂ԂBB
+		__m256 sum_a1 = zero256, error_a1 = zero256;
+		__m256 sum_aa1 = zero256, error_aa1 = zero256;
+
+		// evf 64 B
+		for (; i + 63 < length; i += 64)
+		{
+			__m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 0]), shift_a256);
+			__m256 d1 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 8]), shift_a256);
+			__m256 d2 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 16]), shift_a256);
+			__m256 d3 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 24]), shift_a256);
+			__m256 d4 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 32]), shift_a256);
+			__m256 d5 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 40]), shift_a256);
+			__m256 d6 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 48]), shift_a256);
+			__m256 d7 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 56]), shift_a256);
+
+			compensated_add_ps(&sum_a, &error_a, _mm256_add_ps(_mm256_add_ps(d0, d1), _mm256_add_ps(d2, d3)));
+			compensated_add_ps(&sum_a1, &error_a1, _mm256_add_ps(_mm256_add_ps(d4, d5), _mm256_add_ps(d6, d7)));
+			compensated_add_ps(&sum_aa, &error_aa, _mm256_add_ps(_mm256_fmadd_ps(d0, d0, _mm256_mul_ps(d1, d1)), _mm256_fmadd_ps(d2, d2, _mm256_mul_ps(d3, d3))));
+			compensated_add_ps(&sum_aa1, &error_aa1, _mm256_add_ps(_mm256_fmadd_ps(d4, d4, _mm256_mul_ps(d5, d5)), _mm256_fmadd_ps(d6, d6, _mm256_mul_ps(d7, d7))));
+		}
+
+		// g 1 ɂ܂Ƃ߂B
+		// aǂ␳tőB
+		compensated_add_ps(&sum_a, &error_a, sum_a1);
+		compensated_add_ps(&sum_aa, &error_aa, sum_aa1);
+		error_a = _mm256_add_ps(error_a, error_a1);
+		error_aa = _mm256_add_ps(error_aa, error_aa1);
+
+		for (; i + 7 < length; i += 8)
+		{
+			__m256 d0 = _mm256_sub_ps(_mm256_loadu_ps(&a[i]), shift_a256);
+			compensated_add_ps(&sum_a, &error_a, d0);
+			compensated_add_product_ps(&sum_aa, &error_aa, d0, d0);
+		}
+	}
+	else
+	{
+		// 1 głAZ̑҂Ԃ 1 ̏̂̕ŁAg͕ȂB
+		// evf 32 B
+		for (; i + 31 < length; i += 32)
+		{
+			__m256 da0 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 0]), shift_a256);
+			__m256 da1 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 8]), shift_a256);
+			__m256 da2 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 16]), shift_a256);
+			__m256 da3 = _mm256_sub_ps(_mm256_loadu_ps(&a[i + 24]), shift_a256);
+			__m256 db0 = _mm256_sub_ps(_mm256_loadu_ps(&b[i + 0]), shift_b256);
+			__m256 db1 = _mm256_sub_ps(_mm256_loadu_ps(&b[i + 8]), shift_b256);
+			__m256 db2 = _mm256_sub_ps(_mm256_loadu_ps(&b[i + 16]), shift_b256);
+			__m256 db3 = _mm256_sub_ps(_mm256_loadu_ps(&b[i + 24]), shift_b256);
+
+			compensated_add_ps(&sum_a, &error_a, _mm256_add_ps(_mm256_add_ps(da0, da1), _mm256_add_ps(da2, da3)));
+			compensated_add_ps(&sum_b, &error_b, _mm256_add_ps(_mm256_add_ps(db0, db1), _mm256_add_ps(db2, db3)));
+			compensated_add_ps(&sum_aa, &error_aa, _mm256_add_ps(_mm256_fmadd_ps(da0, da0, _mm256_mul_ps(da1, da1)), _mm256_fmadd_ps(da2, da2, _mm256_mul_ps(da3, da3))));
+			compensated_add_ps(&sum_bb, &error_bb, _mm256_add_ps(_mm256_fmadd_ps(db0, db0, _mm256_mul_ps(db1, db1)), _mm256_fmadd_ps(db2, db2, _mm256_mul_ps(db3, db3))));
+			compensated_add_ps(&sum_ab, &error_ab, _mm256_add_ps(_mm256_fmadd_ps(da0, db0, _mm256_mul_ps(da1, db1)), _mm256_fmadd_ps(da2, db2, _mm256_mul_ps(da3, db3))));
+		}
+
+		for (; i + 7 < length; i += 8)
+		{
+			__m256 da0 = _mm256_sub_ps(_mm256_loadu_ps(&a[i]), shift_a256);
+			__m256 db0 = _mm256_sub_ps(_mm256_loadu_ps(&b[i]), shift_b256);
+
+			compensated_add_ps(&sum_a, &error_a, da0);
+			compensated_add_ps(&sum_b, &error_b, db0);
+			compensated_add_product_ps(&sum_aa, &error_aa, da0, da0);
+			compensated_add_product_ps(&sum_bb, &error_bb, db0, db0);
+			compensated_add_product_ps(&sum_ab, &error_ab, da0, db0);
+		}
+	}
+
+	double s[5];
+	double c[5];
+
+	reduce_neumaier_ps(sum_a, error_a, &s[0], &c[0]);
+	reduce_neumaier_ps(sum_b, error_b, &s[1], &c[1]);
+	reduce_neumaier_ps(sum_aa, error_aa, &s[2], &c[2]);
+	reduce_neumaier_ps(sum_bb, error_bb, &s[3], &c[3]);
+	reduce_neumaier_ps(sum_ab, error_ab, &s[4], &c[4]);
+
+	// c̗vfB
+	// ͔ėp߂ŁA{xőB
+	for (; i < length; i++)
+	{
+		double da = (double)a[i] - shift_a;
+		neumaier_add(&s[0], &c[0], da);
+		neumaier_add_product(&s[2], &c[2], da, da);
+
+		if (b != NULL)
+		{
+			double db = (double)b[i] - shift_b;
+			neumaier_add(&s[1], &c[1], db);
+			neumaier_add_product(&s[3], &c[3], db, db);
+			neumaier_add_product(&s[4], &c[4], da, db);
+		}
+	}
+
+	result->sum_a = s[0] + c[0];
+	result->sum_b = s[1] + c[1];
+	result->sum_aa = s[2] + c[2];
+	result->sum_bb = s[3] + c[3];
+	result->sum_ab = s[4] + c[4];
+}
+
+// Px̔z a  biNULL ł悢jAw肵@ł炵a߂֐B
+void moments_ps(const float a[], const float b[], int length, int options, moments* result)
+{
+	int compensated = options & STATISTICS_COMPENSATED;
+
+	float shift_a = a[0];
+	float shift_b = b != NULL ? b[0] : 0.0f;
+
+	if (options & STATISTICS_TWO_PASS)
+	{
+		if (compensated)
+		{
+			moments_compensated_ps(a, b, length, shift_a, shift_b, result);
+		}
+		else
+		{
+			moments_fast_ps(a, b, length, shift_a, shift_b, result);
+		}
+
+		shift_a = (float)(shift_a + result->sum_a / length);
+		shift_b = (float)(shift_b + result->sum_b / length);
+	}
+
+	if (compensated)
+	{
+		moments_compensated_ps(a, b, length, shift_a, shift_b, result);
+	}
+	else
+	{
+		moments_fast_ps(a, b, length, shift_a, shift_b, result);
+	}
+}
+
+// ėp߂gAPx̔z a ̕U߂֐B
+double dispersion_general_ps(const float a[], int length)
+{
+	float sum = 0.0f;
+	float squared_sum = 0.0f;
+
+	for (int i = 0; i < length; i++)
+	{
+		sum += a[i];
+		squared_sum += a[i] * a[i];
+	}
+
+	double average = (double)sum / length;
+	double squared_average = (double)squared_sum / length;
+
+	return squared_average - (average * average);
+}
+
+// SIMD ߂gAPx̔z a ̕U߂֐B
+double dispersion_ps(const float a[], int length, int options)
+{
+	if (length <= 0)
+	{
+		return NAN;
+	}
+
+	moments m;
+	moments_ps(a, NULL, length, options, &m);
+
+	return variance_from_sums(m.sum_a, m.sum_aa, length);
+}
+
+// SIMD ߂gAPx̔z a  b ̋U߂֐B
+double covariance_ps(const float a[], const float b[], int length, int options)
+{
+	if (length <= 0)
+	{
+		return NAN;
+	}
+
+	moments m;
+	moments_ps(a, b, length, options, &m);
+
+	return covariance_from_sums(m.sum_a, m.sum_b, m.sum_ab, length);
+}
+
+// SIMD ߂gAPx̔z a  b ̑֌W߂֐B
+double correlation_coefficient_ps(const float a[], const float b[], int length, int options)
+{
+	if (length <= 0)
+	{
+		return NAN;
+	}
+
+	moments m;
+	moments_ps(a, b, length, options, &m);
+
+	double covariance = covariance_from_sums(m.sum_a, m.sum_b, m.sum_ab, length);
+	double variance_a = variance_from_sums(m.sum_a, m.sum_aa, length);
+	double variance_b = variance_from_sums(m.sum_b, m.sum_bb, length);
+
+	return covariance / (sqrt(variance_a) * sqrt(variance_b));
+}
+
+int main(void)
+{
+	// ς傫AL肪f[^B
+	// 0  9 JԂ̂ŁAU 8.25Ab = 2a Ȃ̂ő֌W 1B
+	int length = 1000;
+	double* a = (double*)malloc(sizeof(double) * length);
+	double* b = (double*)malloc(sizeof(double) * length);
+	float* c = (float*)malloc(sizeof(float) * length);
+
+	if (a == NULL || b == NULL || c == NULL)
+	{
+		free(a);
+		free(b);
+		free(c);
+		return 1;
+	}
+
+	for (int i = 0; i < length; i++)
+	{
+		a[i] = 1e9 + (i % 10);
+		b[i] = 2.0 * a[i];
+		c[i] = 1e4f + (i % 10);
+	}
+
+	printf("expected dispersion: 8.25, covariance: 16.5, correlation_coefficient: 1\n\n");
+
+	printf("dispersion_general_pd:                 %lf\n", dispersion_general_pd(a, length));
+	printf("dispersion_pd:                         %lf\n", dispersion_pd(a, length, 0));
+	printf("dispersion_pd(COMPENSATED):            %lf\n", dispersion_pd(a, length, STATISTICS_COMPENSATED));
+	printf("dispersion_pd(TWO_PASS):               %lf\n", dispersion_pd(a, length, STATISTICS_TWO_PASS));
+	printf("covariance_general_pd:                 %lf\n", covariance_general_pd(a, b, length));
+	printf("covariance_pd:                         %lf\n", covariance_pd(a, b, length, 0));
+	printf("correlation_coefficient_general_pd:    %lf\n", correlation_coefficient_general_pd(a, b, length));
+	printf("correlation_coefficient_pd:            %lf\n", correlation_coefficient_pd(a, b, length, STATISTICS_TWO_PASS));
+	printf("dispersion_general_ps:                 %lf\n", dispersion_general_ps(c, length));
+	printf("dispersion_ps:                         %lf\n", dispersion_ps(c, length, 0));
+	printf("dispersion_ps(COMPENSATED | TWO_PASS): %lf\n", dispersion_ps(c, length, STATISTICS_COMPENSATED | STATISTICS_TWO_PASS));
+
+	free(a);
+	free(b);
+	free(c);
+
+	// 傫ȔzőxrB
+	int large_length = 1 << 22;
+	double* large_a = (double*)malloc(sizeof(double) * large_length);
+
+	if (large_a == NULL)
+	{
+		return 1;
+	}
+
+	for (int i = 0; i < large_length; i++)
+	{
+		large_a[i] = 1e6 + (i % 1000) * 0.001;
+	}
+
+	// ̌Ăяo܂Ƃ߂Ȃ悤ɁAvf͖ volatile ϐǂށB
+	volatile int repeat_length = large_length;
+
+	int options[] = { 0, STATISTICS_COMPENSATED, STATISTICS_TWO_PASS, STATISTICS_COMPENSATED | STATISTICS_TWO_PASS };
+	const char* names[] = { "fast", "compensated", "two pass", "compensated, two pass" };
+
+	clock_t start = clock();
+	double result = 0.0;
+
+	for (int repeat = 0; repeat < 10; repeat++)
+	{
+		result += dispersion_general_pd(large_a, repeat_length);
+	}
+
+	printf("\ndispersion_general_pd:                 %.12lf (%ld ms)\n", result / 10, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	// SIMD ߂gA炳 1 ŋ߂fpȕ@B
+	// ␳t̕@̑xׂB
+	start = clock();
+	result = 0.0;
+
+	for (int repeat = 0; repeat < 10; repeat++)
+	{
+		result += dispersion_naive_pd(large_a, repeat_length);
+	}
+
+	printf("dispersion_naive_pd:                   %.12lf (%ld ms)\n", result / 10, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	for (int k = 0; k < 4; k++)
+	{
+		start = clock();
+		result = 0.0;
+
+		for (int repeat = 0; repeat < 10; repeat++)
+		{
+			result += dispersion_pd(large_a, repeat_length, options[k]);
+		}
+
+		printf("dispersion_pd(%s):%*s%.12lf (%ld ms)\n", names[k], (int)(23 - strlen(names[k])), "", result / 10, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+	}
+
+	free(large_a);
+
+	return 0;
+}
@@ -0,0 +1,370 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdio.h>
+#include <limits.h>
+#include <time.h>
+#include <vector>
+#include <intrin.h>
+
+// ev[ggAvfƂ̉ZƏWv 1 ̃[vɂ܂Ƃ߂TvB
+// Ⴆ sum(scale(a, k) * b) ́Ar̔z炸 a  b  1 񂸂ǂނŌvZB
+
+// SĂ̎̊NXB
+// Derived  loadi8 vfǂށjAati1 vfǂށjAsizeivfjB
+template <typename Derived>
+struct expression
+{
+	const Derived& self() const
+	{
+		return static_cast<const Derived&>(*this);
+	}
+};
+
+// z\B
+struct array_expression : expression<array_expression>
+{
+	const int* data;
+	int length;
+
+	array_expression(const int a[], int length) : data(a), length(length)
+	{
+	}
+
+	__m256i load(int i) const
+	{
+		return _mm256_loadu_si256((const __m256i*)(&data[i]));
+	}
+
+	int at(int i) const
+	{
+		return data[i];
+	}
+
+	int size() const
+	{
+		return length;
+	}
+};
+
+// SĂ̗vfl̎B
+// vf͑gݍ킹鑊ɍ킹邽߁AőlɂĂB
+struct scalar_expression : expression<scalar_expression>
+{
+	int value;
+	__m256i value256;
+
+	explicit scalar_expression(int value) : value(value), value256(_mm256_set1_epi32(value))
+	{
+	}
+
+	__m256i load(int) const
+	{
+		return value256;
+	}
+
+	int at(int) const
+	{
+		return value;
+	}
+
+	int size() const
+	{
+		return INT_MAX;
+	}
+};
+
+// vfƂ̉ZB
+struct add_operation
+{
+	static __m256i apply(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }
+	static int apply(int a, int b) { return a + b; }
+};
+
+struct subtract_operation
+{
+	static __m256i apply(__m256i a, __m256i b) { return _mm256_sub_epi32(a, b); }
+	static int apply(int a, int b) { return a - b; }
+};
+
+struct multiply_operation
+{
+	static __m256i apply(__m256i a, __m256i b) { return _mm256_mullo_epi32(a, b); }
+	static int apply(int a, int b) { return a * b; }
+};
+
+struct min_operation
+{
+	static __m256i apply(__m256i a, __m256i b) { return _mm256_min_epi32(a, b); }
+	static int apply(int a, int b) { return a < b ? a : b; }
+};
+
+struct max_operation
+{
+	static __m256i apply(__m256i a, __m256i b) { return _mm256_max_epi32(a, b); }
+	static int apply(int a, int b) { return a > b ? a : b; }
+};
+
+// 2 ̗̎vfƂ̉Z\B
+// vZ͓ǂݍ܂ꂽƂɏ߂čsB
+template <typename Left, typename Right, typename Operation>
+struct binary_expression : expression<binary_expression<Left, Right, Operation>>
+{
+	// q̎͒lŎB
+	// ꎞIuWFNgłAQƂɂȂȂB
+	Left left;
+	Right right;
+
+	binary_expression(const Left& left, const Right& right) : left(left), right(right)
+	{
+	}
+
+	__m256i load(int i) const
+	{
+		return Operation::apply(left.load(i), right.load(i));
+	}
+
+	int at(int i) const
+	{
+		return Operation::apply(left.at(i), right.at(i));
+	}
+
+	int size() const
+	{
+		return left.size() < right.size() ? left.size() : right.size();
+	}
+};
+
+template <typename Left, typename Right>
+binary_expression<Left, Right, add_operation> operator+(const expression<Left>& left, const expression<Right>& right)
+{
+	return binary_expression<Left, Right, add_operation>(left.self(), right.self());
+}
+
+template <typename Left, typename Right>
+binary_expression<Left, Right, subtract_operation> operator-(const expression<Left>& left, const expression<Right>& right)
+{
+	return binary_expression<Left, Right, subtract_operation>(left.self(), right.self());
+}
+
+template <typename Left, typename Right>
+binary_expression<Left, Right, multiply_operation> operator*(const expression<Left>& left, const expression<Right>& right)
+{
+	return binary_expression<Left, Right, multiply_operation>(left.self(), right.self());
+}
+
+// z a ƂĈ֐B
+inline array_expression view(const int a[], int length)
+{
+	return array_expression(a, length);
+}
+
+//  a ̊evf scalar {鎮֐B
+template <typename Expression>
+binary_expression<Expression, scalar_expression, multiply_operation> scale(const expression<Expression>& a, int scalar)
+{
+	return binary_expression<Expression, scalar_expression, multiply_operation>(a.self(), scalar_expression(scalar));
+}
+
+//  a  b ̗vfƂ̍ŏl\֐B
+template <typename Left, typename Right>
+binary_expression<Left, Right, min_operation> minimum(const expression<Left>& left, const expression<Right>& right)
+{
+	return binary_expression<Left, Right, min_operation>(left.self(), right.self());
+}
+
+//  a  b ̗vfƂ̍ől\֐B
+template <typename Left, typename Right>
+binary_expression<Left, Right, max_operation> maximum(const expression<Left>& left, const expression<Right>& right)
+{
+	return binary_expression<Left, Right, max_operation>(left.self(), right.self());
+}
+
+// ̑Svf̘a߂֐B
+// Ŝ 1 ̃[vɓWJAr̔z͍ȂB
+template <typename Expression>
+int sum(const expression<Expression>& a)
+{
+	const Expression& e = a.self();
+	int length = e.size();
+	int i = 0;
+
+	// vl 0 ŏB
+	__m256i sum256 = _mm256_setzero_si256();
+
+	// evf 8 B
+	for (; i + 7 < length; i += 8)
+	{
+		sum256 = _mm256_add_epi32(sum256, e.load(i));
+	}
+
+	// vlXJ[lɕϊB
+	__m256i sum256_permute = _mm256_permute2x128_si256(sum256, sum256, 1);
+	__m256i result256 = _mm256_hadd_epi32(sum256, sum256_permute);
+	result256 = _mm256_hadd_epi32(result256, result256);
+	result256 = _mm256_hadd_epi32(result256, result256);
+	int sum = _mm256_extract_epi32(result256, 0);
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		sum += e.at(i);
+	}
+
+	return sum;
+}
+
+//  a  b ̓ς߂֐B
+template <typename Left, typename Right>
+int dot_product(const expression<Left>& a, const expression<Right>& b)
+{
+	return sum(a * b);
+}
+
+struct min_max
+{
+	int min_value;
+	int max_value;
+};
+
+// ̍ŏlƍőlA1 ̃[vœɋ߂֐B
+template <typename Expression>
+min_max minmax(const expression<Expression>& a)
+{
+	const Expression& e = a.self();
+	int length = e.size();
+	int i = 0;
+
+	__m256i min_value256 = _mm256_set1_epi32(INT_MAX);
+	__m256i max_value256 = _mm256_set1_epi32(INT_MIN);
+
+	// evf 8 B
+	// ̒l 1 񂾂vZAŏlƍől̗ɎgB
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = e.load(i);
+		min_value256 = _mm256_min_epi32(min_value256, a256);
+		max_value256 = _mm256_max_epi32(max_value256, a256);
+	}
+
+	// XJ[lɕϊB
+	int min_result[8];
+	int max_result[8];
+	_mm256_storeu_si256((__m256i*)min_result, min_value256);
+	_mm256_storeu_si256((__m256i*)max_result, max_value256);
+
+	min_max result = { min_result[0], max_result[0] };
+
+	for (int j = 1; j < 8; j++)
+	{
+		result.min_value = min_result[j] < result.min_value ? min_result[j] : result.min_value;
+		result.max_value = max_result[j] > result.max_value ? max_result[j] : result.max_value;
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		int value = e.at(i);
+		result.min_value = value < result.min_value ? value : result.min_value;
+		result.max_value = value > result.max_value ? value : result.max_value;
+	}
+
+	return result;
+}
+
+// ]āAʂz result ɏފ֐B
+template <typename Expression>
+void evaluate(const expression<Expression>& a, int result[])
+{
+	const Expression& e = a.self();
+	int length = e.size();
+	int i = 0;
+
+	for (; i + 7 < length; i += 8)
+	{
+		_mm256_storeu_si256((__m256i*)(&result[i]), e.load(i));
+	}
+
+	for (; i < length; i++)
+	{
+		result[i] = e.at(i);
+	}
+}
+
+// ėp߂gAr̔zȂ sum(scale(a, k) * b) ߂֐B
+int scaled_dot_product_general(const int a[], const int b[], int length, int k, int temporary[])
+{
+	for (int i = 0; i < length; i++)
+	{
+		temporary[i] = a[i] * k;
+	}
+
+	for (int i = 0; i < length; i++)
+	{
+		temporary[i] *= b[i];
+	}
+
+	int sum = 0;
+
+	for (int i = 0; i < length; i++)
+	{
+		sum += temporary[i];
+	}
+
+	return sum;
+}
+
+int main(void)
+{
+	int a[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+	int b[] = { 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+	int length = sizeof(a) / sizeof(int);
+
+	array_expression a_view = view(a, length);
+	array_expression b_view = view(b, length);
+
+	printf("sum(a)                 = %d\n", sum(a_view));
+	printf("sum(scale(a, 3) * b)   = %d\n", sum(scale(a_view, 3) * b_view));
+	printf("dot_product(a - b, b)  = %d\n", dot_product(a_view - b_view, b_view));
+
+	min_max range = minmax(a_view - b_view);
+	printf("minmax(a - b)          = (%d, %d)\n", range.min_value, range.max_value);
+
+	range = minmax(minimum(a_view, b_view) + scalar_expression(100));
+	printf("minmax(min(a, b) + 100) = (%d, %d)\n", range.min_value, range.max_value);
+
+	int result[sizeof(a) / sizeof(int)];
+	evaluate(scale(a_view + b_view, 2), result);
+	printf("evaluate(scale(a + b, 2)) =");
+
+	for (int i = 0; i < length; i++)
+	{
+		printf(" %d", result[i]);
+	}
+	printf("\n");
+
+	// 傫ȔzőxrB
+	int large_length = 1 << 24;
+	std::vector<int> large_a(large_length);
+	std::vector<int> large_b(large_length);
+	std::vector<int> temporary(large_length);
+
+	// a int ͈̔͂Ɏ܂悤ɁAlB
+	for (int i = 0; i < large_length; i++)
+	{
+		large_a[i] = i % 8;
+		large_b[i] = i % 4;
+	}
+
+	clock_t start = clock();
+	int result_general = scaled_dot_product_general(large_a.data(), large_b.data(), large_length, 3, temporary.data());
+	printf("\nscaled_dot_product_general = %d (%ld ms)\n", result_general, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	int result_fused = sum(scale(view(large_a.data(), large_length), 3) * view(large_b.data(), large_length));
+	printf("sum(scale(a, 3) * b)       = %d (%ld ms)\n", result_fused, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	return 0;
+}
@@ -0,0 +1,732 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <math.h>
+#include <time.h>
+#include <intrin.h>
+
+// SIMD ̃[B
+#define LANE_COUNT 8
+
+// O[vȉȂAO[vƂɔr SIMD ̃WX^ŏWvB
+// 1 vf̖ߐO[vɔႷ̂ŁAȂƂB
+// 1 Xbh 1600 vfWvƁA2 O[v 27 msiėp߂ 41 msjA
+// 4 O[v 38 msi37 msjA8 O[v 71 msi54 msjB
+#ifndef SMALL_GROUP_COUNT
+#define SMALL_GROUP_COUNT 4
+#endif
+
+// O[vȉȂA[Ƃɕʂ̏Wv\B
+// Wv\̓O[v 8 {̑傫ɂȂ̂ŁALbVɎ܂͈͂ɌB
+// gather Ə߂̖߂A8  1024 O[v̂ǂłėp߂葬ȂȂ
+// i64 O[v 52 msAėp߂ 40 msĵŁAł͎gȂB
+#ifndef LANE_TABLE_MAX_GROUPS
+#define LANE_TABLE_MAX_GROUPS 0
+#endif
+
+// 0 ȊOȂAAVX-512 g CPU ŁAO[vƂɏՓˌo߂gB
+// 1024 O[v 57 msiėp߂ 59 msjA16384 O[v 171 msi56 msjƁA
+// ėp߂Ȃ̂ŁAł͎gȂB
+#ifndef USE_CONFLICT_DETECTION
+#define USE_CONFLICT_DETECTION 0
+#endif
+
+// O[vȂƂɁA܂Ƃ߂ďvfB
+// L[ƒl L1 LbVɎ܂傫ɂB
+#define SMALL_GROUP_BLOCK 1024
+
+// eXbhɓnvfB
+#define CHUNK_LENGTH (1 << 16)
+
+// vfȏȂÃXbhŏB
+#ifndef PARALLEL_THRESHOLD
+#define PARALLEL_THRESHOLD (1 << 20)
+#endif
+
+// 1 ̃O[v̏WvʁB
+// aƓa̓I[o[t[Ȃ悤 64 rbgŎB
+typedef struct
+{
+	long long sum;
+	long long squared_sum;
+	int count;
+	int min_value;
+	int max_value;
+} group_aggregate;
+
+// Wvʂ֐B
+void init_group_aggregates(group_aggregate result[], int group_count)
+{
+	for (int g = 0; g < group_count; g++)
+	{
+		result[g].sum = 0;
+		result[g].squared_sum = 0;
+		result[g].count = 0;
+		result[g].min_value = INT_MAX;
+		result[g].max_value = INT_MIN;
+	}
+}
+
+// Wvʂ 1 ̒l֐B
+void update_group_aggregate(group_aggregate* aggregate, int value)
+{
+	aggregate->sum += value;
+	aggregate->squared_sum += (long long)value * value;
+	aggregate->count++;
+	aggregate->min_value = value < aggregate->min_value ? value : aggregate->min_value;
+	aggregate->max_value = value > aggregate->max_value ? value : aggregate->max_value;
+}
+
+// Wv from  to ɂ܂Ƃ߂֐B
+void merge_group_aggregate(group_aggregate* to, const group_aggregate* from)
+{
+	to->sum += from->sum;
+	to->squared_sum += from->squared_sum;
+	to->count += from->count;
+	to->min_value = from->min_value < to->min_value ? from->min_value : to->min_value;
+	to->max_value = from->max_value > to->max_value ? from->max_value : to->max_value;
+}
+
+// O[v̕ς߂֐B
+double group_mean(const group_aggregate* aggregate)
+{
+	if (aggregate->count == 0)
+	{
+		return NAN;
+	}
+
+	return (double)aggregate->sum / aggregate->count;
+}
+
+// O[v̕U߂֐B
+// ̕ς畽ς̓ƁAlςɔׂđ傫ƂɌB
+// ŁAɊۂ߂ q ̕΍̓a (x - q)^2 = x^2 - 2qx + nq^2 𐮐̂܂܋߁A
+// ۂ߂̍ r = x - nq ̕ r^2 / n B
+// (x - q)^2  0 ȏ 64 rbg̕ȂɎ܂̂ŁAřvZaӂꂵĂA
+// Ȃ̌vZŐ܂B
+double group_variance(const group_aggregate* aggregate)
+{
+	if (aggregate->count == 0)
+	{
+		return NAN;
+	}
+
+	long long count = aggregate->count;
+	long long q = aggregate->sum / count;
+	long long r = aggregate->sum - q * count;
+
+	unsigned long long squared_deviation = (unsigned long long)aggregate->squared_sum
+		- 2 * (unsigned long long)q * (unsigned long long)aggregate->sum
+		+ (unsigned long long)count * (unsigned long long)q * (unsigned long long)q;
+
+	return ((double)squared_deviation - (double)r * r / count) / count;
+}
+
+// ėp߂gAL[ keys[i] Ƃɒl values[i] Wv֐B
+// L[ 0 ȏ group_count ł邱ƁB
+void group_by_general(const int keys[], const int values[], int length, int group_count, group_aggregate result[])
+{
+	init_group_aggregates(result, group_count);
+
+	for (int i = 0; i < length; i++)
+	{
+		update_group_aggregate(&result[keys[i]], values[i]);
+	}
+}
+
+// ėp߂gWvs֐B
+// ʂ result ɉB
+void accumulate_general(const int keys[], const int values[], int length, group_aggregate result[])
+{
+	for (int i = 0; i < length; i++)
+	{
+		update_group_aggregate(&result[keys[i]], values[i]);
+	}
+}
+
+// SIMD ߂gAO[vȂƂ̏Wvs֐B
+// eO[v̏Wvl[ƂɃWX^Ɏ̂ŁA݂̋NȂB
+// ʂ result ɉB
+void accumulate_small_groups(const int keys[], const int values[], int length, int group_count, group_aggregate result[])
+{
+	__m256i max256 = _mm256_set1_epi32(INT_MAX);
+	__m256i min256 = _mm256_set1_epi32(INT_MIN);
+
+	int block_end = length - length % 8;
+
+	for (int block = 0; block < block_end; block += SMALL_GROUP_BLOCK)
+	{
+		int end = block + SMALL_GROUP_BLOCK < block_end ? block + SMALL_GROUP_BLOCK : block_end;
+
+		// ubN L1 LbVɒu܂܁AO[vƂɓǂݒB
+		for (int g = 0; g < group_count; g++)
+		{
+			__m256i group256 = _mm256_set1_epi32(g);
+			__m256i count256 = _mm256_setzero_si256();
+			__m256i sum_low256 = _mm256_setzero_si256();
+			__m256i sum_high256 = _mm256_setzero_si256();
+			__m256i squared_sum_low256 = _mm256_setzero_si256();
+			__m256i squared_sum_high256 = _mm256_setzero_si256();
+			__m256i min_value256 = max256;
+			__m256i max_value256 = min256;
+
+			for (int i = block; i < end; i += 8)
+			{
+				__m256i key256 = _mm256_loadu_si256((__m256i*)(&keys[i]));
+				__m256i value256 = _mm256_loadu_si256((__m256i*)(&values[i]));
+				__m256i mask256 = _mm256_cmpeq_epi32(key256, group256);
+
+				// }XN -1 Ȃ̂ŁAƌ 1 B
+				count256 = _mm256_sub_epi32(count256, mask256);
+
+				min_value256 = _mm256_min_epi32(min_value256, _mm256_blendv_epi8(max256, value256, mask256));
+				max_value256 = _mm256_max_epi32(max_value256, _mm256_blendv_epi8(min256, value256, mask256));
+
+				// aƓa 64 rbgɍLĂ瑫B
+				__m256i selected256 = _mm256_and_si256(value256, mask256);
+				__m256i low256 = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(selected256));
+				__m256i high256 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(selected256, 1));
+
+				sum_low256 = _mm256_add_epi64(sum_low256, low256);
+				sum_high256 = _mm256_add_epi64(sum_high256, high256);
+				squared_sum_low256 = _mm256_add_epi64(squared_sum_low256, _mm256_mul_epi32(low256, low256));
+				squared_sum_high256 = _mm256_add_epi64(squared_sum_high256, _mm256_mul_epi32(high256, high256));
+			}
+
+			// [Ƃ̏Wvl܂Ƃ߂B
+			long long sum[4];
+			long long squared_sum[4];
+			int count[8];
+			int min_value[8];
+			int max_value[8];
+
+			_mm256_storeu_si256((__m256i*)sum, _mm256_add_epi64(sum_low256, sum_high256));
+			_mm256_storeu_si256((__m256i*)squared_sum, _mm256_add_epi64(squared_sum_low256, squared_sum_high256));
+			_mm256_storeu_si256((__m256i*)count, count256);
+			_mm256_storeu_si256((__m256i*)min_value, min_value256);
+			_mm256_storeu_si256((__m256i*)max_value, max_value256);
+
+			group_aggregate* aggregate = &result[g];
+
+			for (int j = 0; j < 4; j++)
+			{
+				aggregate->sum += sum[j];
+				aggregate->squared_sum += squared_sum[j];
+			}
+
+			for (int j = 0; j < 8; j++)
+			{
+				aggregate->count += count[j];
+				aggregate->min_value = min_value[j] < aggregate->min_value ? min_value[j] : aggregate->min_value;
+				aggregate->max_value = max_value[j] > aggregate->max_value ? max_value[j] : aggregate->max_value;
+			}
+		}
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (int i = block_end; i < length; i++)
+	{
+		update_group_aggregate(&result[keys[i]], values[i]);
+	}
+}
+
+// WvʂڂƂ̔zŎWv\B
+// ̃O[v̏WvlAgather  scatter ł܂Ƃ߂ēǂݏłB
+typedef struct
+{
+	int* counts;
+	int* min_values;
+	int* max_values;
+	long long* sums;
+	long long* squared_sums;
+} aggregate_table;
+
+// length ̏WvlWv\֐B
+// [mۂłȂꍇ́ASẴ|C^[ NULL ɂȂB
+aggregate_table aggregate_table_create(int length)
+{
+	aggregate_table table;
+	table.counts = (int*)malloc(sizeof(int) * length);
+	table.min_values = (int*)malloc(sizeof(int) * length);
+	table.max_values = (int*)malloc(sizeof(int) * length);
+	table.sums = (long long*)malloc(sizeof(long long) * length);
+	table.squared_sums = (long long*)malloc(sizeof(long long) * length);
+
+	if (table.counts == NULL || table.min_values == NULL || table.max_values == NULL || table.sums == NULL || table.squared_sums == NULL)
+	{
+		free(table.counts);
+		free(table.min_values);
+		free(table.max_values);
+		free(table.sums);
+		free(table.squared_sums);
+
+		aggregate_table empty = { NULL, NULL, NULL, NULL, NULL };
+		return empty;
+	}
+
+	for (int i = 0; i < length; i++)
+	{
+		table.counts[i] = 0;
+		table.min_values[i] = INT_MAX;
+		table.max_values[i] = INT_MIN;
+		table.sums[i] = 0;
+		table.squared_sums[i] = 0;
+	}
+
+	return table;
+}
+
+void aggregate_table_free(aggregate_table* table)
+{
+	free(table->counts);
+	free(table->min_values);
+	free(table->max_values);
+	free(table->sums);
+	free(table->squared_sums);
+}
+
+// Wv\ index Ԗڂ 1 ̒l֐B
+void aggregate_table_update(aggregate_table* table, int index, int value)
+{
+	table->counts[index]++;
+	table->min_values[index] = value < table->min_values[index] ? value : table->min_values[index];
+	table->max_values[index] = value > table->max_values[index] ? value : table->max_values[index];
+	table->sums[index] += value;
+	table->squared_sums[index] += (long long)value * value;
+}
+
+// Wv\ index ԖڂWv to ɂ܂Ƃ߂֐B
+void aggregate_table_merge(const aggregate_table* table, int index, group_aggregate* to)
+{
+	group_aggregate from = { table->sums[index], table->squared_sums[index], table->counts[index], table->min_values[index], table->max_values[index] };
+	merge_group_aggregate(to, &from);
+}
+
+// AVX-512FAAVX-512CDAAVX-512VL g邩ǂ𒲂ׂ֐B
+// /arch:AVX512 w肵ȂĂ AVX-512 ̑gݍ݊֐̓RpCł̂ŁA
+// CPU  OS ΉĂ邩sɊmFĂĂяoB
+int avx512_available(void)
+{
+	static int available = -1;
+
+	if (available < 0)
+	{
+		int info[4];
+		available = 0;
+
+		__cpuid(info, 0);
+
+		if (info[0] >= 7)
+		{
+			__cpuid(info, 1);
+
+			// OS  XSAVE LɂĂāAYMMA}XNWX^[AZMM ̏Ԃۑ邱ƁB
+			if ((info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0xE6) == 0xE6)
+			{
+				__cpuidex(info, 7, 0);
+
+				int f = (info[1] & (1 << 16)) != 0;
+				int cd = (info[1] & (1 << 28)) != 0;
+				int vl = ((unsigned int)info[1] & (1u << 31)) != 0;
+				available = f && cd && vl;
+			}
+		}
+	}
+
+	return available;
+}
+
+// AVX2 gāA[Ƃ̏Wv\ 8 vfXV֐B
+// vfԂB
+int update_lane_tables_avx2(aggregate_table* table, const int keys[], const int values[], int length)
+{
+	__m256i lane256 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	__m256i one256 = _mm256_set1_epi32(1);
+
+	int i = 0;
+
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i key256 = _mm256_loadu_si256((__m256i*)(&keys[i]));
+		__m256i value256 = _mm256_loadu_si256((__m256i*)(&values[i]));
+
+		// [ j ̓L[ g ̏Wv\ g * 8 + j ԖڂĝŁA8 ̈ʒu͕KقȂB
+		__m256i offset256 = _mm256_add_epi32(_mm256_slli_epi32(key256, 3), lane256);
+		__m128i offset_low128 = _mm256_castsi256_si128(offset256);
+		__m128i offset_high128 = _mm256_extracti128_si256(offset256, 1);
+
+		__m256i count256 = _mm256_add_epi32(_mm256_i32gather_epi32(table->counts, offset256, 4), one256);
+		__m256i min_value256 = _mm256_min_epi32(_mm256_i32gather_epi32(table->min_values, offset256, 4), value256);
+		__m256i max_value256 = _mm256_max_epi32(_mm256_i32gather_epi32(table->max_values, offset256, 4), value256);
+
+		// aƓa 64 rbgɍLA4 vfXVB
+		__m256i value_low256 = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(value256));
+		__m256i value_high256 = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(value256, 1));
+
+		__m256i sum_low256 = _mm256_add_epi64(_mm256_i32gather_epi64(table->sums, offset_low128, 8), value_low256);
+		__m256i sum_high256 = _mm256_add_epi64(_mm256_i32gather_epi64(table->sums, offset_high128, 8), value_high256);
+		__m256i squared_sum_low256 = _mm256_add_epi64(_mm256_i32gather_epi64(table->squared_sums, offset_low128, 8), _mm256_mul_epi32(value_low256, value_low256));
+		__m256i squared_sum_high256 = _mm256_add_epi64(_mm256_i32gather_epi64(table->squared_sums, offset_high128, 8), _mm256_mul_epi32(value_high256, value_high256));
+
+		// AVX2 ɂ scatter Ȃ̂ŁA߂͔ėp߁B
+		int offset[8];
+		int count[8];
+		int min_value[8];
+		int max_value[8];
+		long long sum[8];
+		long long squared_sum[8];
+
+		_mm256_storeu_si256((__m256i*)offset, offset256);
+		_mm256_storeu_si256((__m256i*)count, count256);
+		_mm256_storeu_si256((__m256i*)min_value, min_value256);
+		_mm256_storeu_si256((__m256i*)max_value, max_value256);
+		_mm256_storeu_si256((__m256i*)(&sum[0]), sum_low256);
+		_mm256_storeu_si256((__m256i*)(&sum[4]), sum_high256);
+		_mm256_storeu_si256((__m256i*)(&squared_sum[0]), squared_sum_low256);
+		_mm256_storeu_si256((__m256i*)(&squared_sum[4]), squared_sum_high256);
+
+		for (int j = 0; j < 8; j++)
+		{
+			table->counts[offset[j]] = count[j];
+			table->min_values[offset[j]] = min_value[j];
+			table->max_values[offset[j]] = max_value[j];
+			table->sums[offset[j]] = sum[j];
+			table->squared_sums[offset[j]] = squared_sum[j];
+		}
+	}
+
+	return i;
+}
+
+// AVX-512 gāA[Ƃ̏Wv\ 8 vfXV֐B
+// 8 ̈ʒu͕KقȂ̂ŁAՓ˂𒲂ׂ scatter ŏ߂B
+// vfԂB
+int update_lane_tables_avx512(aggregate_table* table, const int keys[], const int values[], int length)
+{
+	__m256i lane256 = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	__m256i one256 = _mm256_set1_epi32(1);
+
+	int i = 0;
+
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i key256 = _mm256_loadu_si256((__m256i*)(&keys[i]));
+		__m256i value256 = _mm256_loadu_si256((__m256i*)(&values[i]));
+		__m256i offset256 = _mm256_add_epi32(_mm256_slli_epi32(key256, 3), lane256);
+
+		__m256i count256 = _mm256_add_epi32(_mm256_i32gather_epi32(table->counts, offset256, 4), one256);
+		__m256i min_value256 = _mm256_min_epi32(_mm256_i32gather_epi32(table->min_values, offset256, 4), value256);
+		__m256i max_value256 = _mm256_max_epi32(_mm256_i32gather_epi32(table->max_values, offset256, 4), value256);
+
+		_mm256_i32scatter_epi32(table->counts, offset256, count256, 4);
+		_mm256_i32scatter_epi32(table->min_values, offset256, min_value256, 4);
+		_mm256_i32scatter_epi32(table->max_values, offset256, max_value256, 4);
+
+		// aƓa 64 rbgɍLA8 vf܂Ƃ߂čXVB
+		__m512i value512 = _mm512_cvtepi32_epi64(value256);
+		__m512i sum512 = _mm512_add_epi64(_mm512_i32gather_epi64(offset256, table->sums, 8), value512);
+		__m512i squared_sum512 = _mm512_add_epi64(_mm512_i32gather_epi64(offset256, table->squared_sums, 8), _mm512_mul_epi32(value512, value512));
+
+		_mm512_i32scatter_epi64(table->sums, offset256, sum512, 8);
+		_mm512_i32scatter_epi64(table->squared_sums, offset256, squared_sum512, 8);
+	}
+
+	return i;
+}
+
+// [Ƃɕʂ̏Wv\gďWv֐B
+// A 8 vf͕Kʂ̏Wv\ɏނ̂ŁAL[Ă
+// ݂Փ˂A8 vf܂Ƃ߂ gather œǂݍ߂B
+// ʂ result ɉB
+void accumulate_lane_tables(const int keys[], const int values[], int length, int group_count, group_aggregate result[])
+{
+	// L[ gA[ j ̏Wvl g * LANE_COUNT + j ԖځB
+	aggregate_table table = aggregate_table_create(group_count * LANE_COUNT);
+
+	if (table.counts == NULL)
+	{
+		accumulate_general(keys, values, length, result);
+		return;
+	}
+
+	int i = avx512_available()
+		? update_lane_tables_avx512(&table, keys, values, length)
+		: update_lane_tables_avx2(&table, keys, values, length);
+
+	// c̗vfB
+	for (; i < length; i++)
+	{
+		aggregate_table_update(&table, keys[i] * LANE_COUNT, values[i]);
+	}
+
+	// [Ƃ̏Wvl܂Ƃ߂B
+	for (int g = 0; g < group_count; g++)
+	{
+		for (int j = 0; j < LANE_COUNT; j++)
+		{
+			aggregate_table_merge(&table, g * LANE_COUNT + j, &result[g]);
+		}
+	}
+
+	aggregate_table_free(&table);
+}
+
+// AVX-512 ̏Փˌo߂gAO[vƂ̏Wvs֐B
+// 16 ̃L[ɏdȂ΁Agather  scatter ł܂Ƃ߂čXVB
+// dƂ́A 16 vfėp߂ŏB
+// AVX-512 g邱ƂmFĂĂяoƁB
+// ʂ result ɉB
+void accumulate_conflict_detection(const int keys[], const int values[], int length, int group_count, group_aggregate result[])
+{
+	aggregate_table table = aggregate_table_create(group_count);
+
+	int i = 0;
+
+	if (table.counts != NULL)
+	{
+		__m512i one512 = _mm512_set1_epi32(1);
+
+		for (; i + 15 < length; i += 16)
+		{
+			__m512i key512 = _mm512_loadu_si512(&keys[i]);
+			__m512i value512 = _mm512_loadu_si512(&values[i]);
+
+			// e[ɂāAÕ[ɓL[邩𒲂ׂB
+			__m512i conflict512 = _mm512_conflict_epi32(key512);
+
+			if (_mm512_test_epi32_mask(conflict512, conflict512) == 0)
+			{
+				__m512i count512 = _mm512_add_epi32(_mm512_i32gather_epi32(key512, table.counts, 4), one512);
+				__m512i min_value512 = _mm512_min_epi32(_mm512_i32gather_epi32(key512, table.min_values, 4), value512);
+				__m512i max_value512 = _mm512_max_epi32(_mm512_i32gather_epi32(key512, table.max_values, 4), value512);
+
+				_mm512_i32scatter_epi32(table.counts, key512, count512, 4);
+				_mm512_i32scatter_epi32(table.min_values, key512, min_value512, 4);
+				_mm512_i32scatter_epi32(table.max_values, key512, max_value512, 4);
+
+				// aƓa 64 rbgɍLA8 vfXVB
+				__m256i key_low256 = _mm512_castsi512_si256(key512);
+				__m256i key_high256 = _mm512_extracti64x4_epi64(key512, 1);
+				__m512i value_low512 = _mm512_cvtepi32_epi64(_mm512_castsi512_si256(value512));
+				__m512i value_high512 = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(value512, 1));
+
+				__m512i sum_low512 = _mm512_add_epi64(_mm512_i32gather_epi64(key_low256, table.sums, 8), value_low512);
+				__m512i sum_high512 = _mm512_add_epi64(_mm512_i32gather_epi64(key_high256, table.sums, 8), value_high512);
+				_mm512_i32scatter_epi64(table.sums, key_low256, sum_low512, 8);
+				_mm512_i32scatter_epi64(table.sums, key_high256, sum_high512, 8);
+
+				__m512i squared_low512 = _mm512_mul_epi32(value_low512, value_low512);
+				__m512i squared_high512 = _mm512_mul_epi32(value_high512, value_high512);
+				__m512i squared_sum_low512 = _mm512_add_epi64(_mm512_i32gather_epi64(key_low256, table.squared_sums, 8), squared_low512);
+				__m512i squared_sum_high512 = _mm512_add_epi64(_mm512_i32gather_epi64(key_high256, table.squared_sums, 8), squared_high512);
+				_mm512_i32scatter_epi64(table.squared_sums, key_low256, squared_sum_low512, 8);
+				_mm512_i32scatter_epi64(table.squared_sums, key_high256, squared_sum_high512, 8);
+			}
+			else
+			{
+				for (int j = i; j < i + 16; j++)
+				{
+					aggregate_table_update(&table, keys[j], values[j]);
+				}
+			}
+		}
+
+		for (int g = 0; g < group_count; g++)
+		{
+			aggregate_table_merge(&table, g, &result[g]);
+		}
+
+		aggregate_table_free(&table);
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		update_group_aggregate(&result[keys[i]], values[i]);
+	}
+}
+
+// O[vɉďWv@IԊ֐B
+// ėp߂葬ƌvŊm߂@IсAȊO͔ėp߂ŏWvB
+// ʂ result ɉB
+void accumulate_group_by(const int keys[], const int values[], int length, int group_count, group_aggregate result[])
+{
+	if (group_count <= SMALL_GROUP_COUNT)
+	{
+		accumulate_small_groups(keys, values, length, group_count, result);
+	}
+	else if (group_count <= LANE_TABLE_MAX_GROUPS)
+	{
+		accumulate_lane_tables(keys, values, length, group_count, result);
+	}
+	else if (USE_CONFLICT_DETECTION && avx512_available())
+	{
+		accumulate_conflict_detection(keys, values, length, group_count, result);
+	}
+	else
+	{
+		accumulate_general(keys, values, length, result);
+	}
+}
+
+// SIMD ߂gAL[ keys[i] Ƃɒl values[i] Wv֐B
+// L[ 0 ȏ group_count ł邱ƁB
+// vfƂ͔z𕪊ĕ̃XbhŏWvAŌɂ܂Ƃ߂B
+void group_by(const int keys[], const int values[], int length, int group_count, group_aggregate result[])
+{
+	init_group_aggregates(result, group_count);
+
+	if (length < PARALLEL_THRESHOLD)
+	{
+		accumulate_group_by(keys, values, length, group_count, result);
+		return;
+	}
+
+	int chunk_count = (length + CHUNK_LENGTH - 1) / CHUNK_LENGTH;
+	int allocation_failed = 0;
+
+	#pragma omp parallel
+	{
+		// XbhƂɏWvʂAŌɂ܂Ƃ߂B
+		group_aggregate* partial = (group_aggregate*)malloc(sizeof(group_aggregate) * group_count);
+
+		if (partial == NULL)
+		{
+			#pragma omp critical
+			allocation_failed = 1;
+		}
+
+		// omp for ͑SẴXbhʂKvB
+		// 1 łmۂɎsASẴXbhĕ̏Wv߂B
+		#pragma omp barrier
+
+		if (!allocation_failed)
+		{
+			init_group_aggregates(partial, group_count);
+
+			#pragma omp for schedule(static)
+			for (int chunk = 0; chunk < chunk_count; chunk++)
+			{
+				int start = chunk * CHUNK_LENGTH;
+				int chunk_length = length - start < CHUNK_LENGTH ? length - start : CHUNK_LENGTH;
+
+				accumulate_group_by(&keys[start], &values[start], chunk_length, group_count, partial);
+			}
+
+			#pragma omp critical
+			for (int g = 0; g < group_count; g++)
+			{
+				merge_group_aggregate(&result[g], &partial[g]);
+			}
+		}
+
+		free(partial);
+	}
+
+	// ɏWvłȂꍇ́A1 ̃XbhŏWvB
+	if (allocation_failed)
+	{
+		accumulate_group_by(keys, values, length, group_count, result);
+	}
+}
+
+typedef void (*accumulate_function)(const int keys[], const int values[], int length, int group_count, group_aggregate result[]);
+
+// Wv@ function ̎Ԃ𑪂AO[v 0 ̘aƈꏏɕ\֐B
+void time_accumulate(const char* name, accumulate_function function, const int keys[], const int values[], int length, int group_count, group_aggregate result[])
+{
+	init_group_aggregates(result, group_count);
+
+	clock_t start = clock();
+	function(keys, values, length, group_count, result);
+	printf("%s%lld (%ld ms)\n", name, result[0].sum, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+}
+
+void print_group_aggregates(const char* name, const group_aggregate result[], int group_count)
+{
+	printf("%s\n", name);
+
+	for (int g = 0; g < group_count; g++)
+	{
+		if (result[g].count == 0)
+		{
+			printf("  group %d: empty\n", g);
+			continue;
+		}
+
+		printf("  group %d: count = %d, sum = %lld, min = %d, max = %d, mean = %lf, variance = %lf\n",
+			g, result[g].count, result[g].sum, result[g].min_value, result[g].max_value,
+			group_mean(&result[g]), group_variance(&result[g]));
+	}
+}
+
+int main(void)
+{
+	int keys[] = { 0, 1, 2, 0, 1, 2, 0, 1, 2, 0, 0, 1, 3 };
+	int values[] = { 5, 8, 1, 9, 2, 7, 3, 6, 4, 10, -1, 12, 100 };
+	int length = sizeof(keys) / sizeof(int);
+	int group_count = 5;
+	group_aggregate result[5];
+
+	group_by_general(keys, values, length, group_count, result);
+	print_group_aggregates("group_by_general:", result, group_count);
+
+	group_by(keys, values, length, group_count, result);
+	print_group_aggregates("group_by:", result, group_count);
+
+	// 傫ȔzőxrB
+	int large_length = 1 << 24;
+	int* large_keys = (int*)malloc(sizeof(int) * large_length);
+	int* large_values = (int*)malloc(sizeof(int) * large_length);
+	group_aggregate* large_result = (group_aggregate*)malloc(sizeof(group_aggregate) * 1024);
+
+	if (large_keys == NULL || large_values == NULL || large_result == NULL)
+	{
+		free(large_keys);
+		free(large_values);
+		free(large_result);
+		return 1;
+	}
+
+	// eWv@̎Ԃ\Aaccumulate_group_by ̑Iѕm߂B
+	int group_counts[] = { 2, 4, 64, 1024 };
+
+	for (int c = 0; c < 4; c++)
+	{
+		for (int i = 0; i < large_length; i++)
+		{
+			large_keys[i] = (int)((i * 2654435761u) >> 8) % group_counts[c];
+			large_values[i] = i % 1000;
+		}
+
+		clock_t start = clock();
+		group_by_general(large_keys, large_values, large_length, group_counts[c], large_result);
+		printf("\ngroups = %d\ngroup_by_general:              %lld (%ld ms)\n", group_counts[c], large_result[0].sum, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+		// O[vƂɓǂݒ̂ŁAO[vƒxB
+		if (group_counts[c] <= 64)
+		{
+			time_accumulate("accumulate_small_groups:       ", accumulate_small_groups, large_keys, large_values, large_length, group_counts[c], large_result);
+		}
+
+		time_accumulate("accumulate_lane_tables:        ", accumulate_lane_tables, large_keys, large_values, large_length, group_counts[c], large_result);
+
+		if (avx512_available())
+		{
+			time_accumulate("accumulate_conflict_detection: ", accumulate_conflict_detection, large_keys, large_values, large_length, group_counts[c], large_result);
+		}
+
+		time_accumulate("group_by:                      ", group_by, large_keys, large_values, large_length, group_counts[c], large_result);
+	}
+
+	free(large_keys);
+	free(large_values);
+	free(large_result);
+
+	return 0;
+}
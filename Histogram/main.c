@@ -0,0 +1,639 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <intrin.h>
+
+// SIMD ̃[B
+// [Ƃɕʂ̕qXgO̂ŁAqXgO̐łB
+#define LANE_COUNT 8
+
+// l̎ނȉȂAlƂɔr SIMD ̃WX^ŐB
+#ifndef SMALL_DOMAIN
+#define SMALL_DOMAIN 8
+#endif
+
+// E̐ȉȂA񕪒Tł͂ȂSĂ̋EƔrB
+#ifndef LINEAR_SEARCH_MAX
+#define LINEAR_SEARCH_MAX 8
+#endif
+
+// l̎ނȂƂɁA܂Ƃ߂ďvfB
+#define SMALL_DOMAIN_BLOCK 1024
+
+// eXbhɓnvfB
+#define CHUNK_LENGTH (1 << 16)
+
+// vfȏȂÃXbhŏB
+#ifndef PARALLEL_THRESHOLD
+#define PARALLEL_THRESHOLD (1 << 20)
+#endif
+
+// qXgO counts ɂ܂Ƃ߂֐B
+// sub_counts  bin_count  LANE_COUNT łB
+void merge_sub_histograms(const int sub_counts[], int bin_count, int counts[])
+{
+	int i = 0;
+
+	for (; i + 7 < bin_count; i += 8)
+	{
+		__m256i sum256 = _mm256_loadu_si256((__m256i*)(&counts[i]));
+
+		for (int j = 0; j < LANE_COUNT; j++)
+		{
+			sum256 = _mm256_add_epi32(sum256, _mm256_loadu_si256((__m256i*)(&sub_counts[j * bin_count + i])));
+		}
+
+		_mm256_storeu_si256((__m256i*)(&counts[i]), sum256);
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < bin_count; i++)
+	{
+		for (int j = 0; j < LANE_COUNT; j++)
+		{
+			counts[i] += sub_counts[j * bin_count + i];
+		}
+	}
+}
+
+// ėp߂gAԂ̃qXgO߂֐B
+//  k  [low + k * width, low + (k + 1) * width)Awidth = (high - low) / bin_countB
+// ͈͊O̒l͍ŏƍŌ̋ԂɐB
+void histogram_fixed_width_general(const float a[], int length, float low, float high, int bin_count, int counts[])
+{
+	float inverse_width = bin_count / (high - low);
+	float last = (float)(bin_count - 1);
+
+	memset(counts, 0, sizeof(int) * bin_count);
+
+	for (int i = 0; i < length; i++)
+	{
+		float t = (a[i] - low) * inverse_width;
+
+		// NaN ŏ̋ԂɐB
+		t = t >= 0.0f ? t : 0.0f;
+		t = t < last ? t : last;
+
+		counts[(int)t]++;
+	}
+}
+
+// SIMD ߂gAԂ̃qXgO counts ɉ֐B
+void accumulate_fixed_width(const float a[], int length, float low, float inverse_width, int bin_count, int counts[])
+{
+	int* sub_counts = (int*)calloc((size_t)bin_count * LANE_COUNT, sizeof(int));
+	float last = (float)(bin_count - 1);
+	int i = 0;
+
+	if (sub_counts != NULL)
+	{
+		__m256 low256 = _mm256_set1_ps(low);
+		__m256 inverse_width256 = _mm256_set1_ps(inverse_width);
+		__m256 zero256 = _mm256_setzero_ps();
+		__m256 last256 = _mm256_set1_ps(last);
+
+		// [ j ̕qXgO̐擪ʒuB
+		__m256i offset256 = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(bin_count));
+
+		int index[8];
+
+		for (; i + 7 < length; i += 8)
+		{
+			__m256 a256 = _mm256_loadu_ps(&a[i]);
+			__m256 t256 = _mm256_mul_ps(_mm256_sub_ps(a256, low256), inverse_width256);
+
+			// ɕϊOɔ͈͂Ɏ߂B
+			// max_ps ͑ 1  NaN ̂Ƃ 2 Ԃ̂ŁANaN  0 ɂȂB
+			t256 = _mm256_max_ps(t256, zero256);
+			t256 = _mm256_min_ps(t256, last256);
+
+			__m256i index256 = _mm256_add_epi32(_mm256_cvttps_epi32(t256), offset256);
+			_mm256_storeu_si256((__m256i*)index, index256);
+
+			// e[͕ʂ̕qXgOɏނ̂ŁA
+			// ԂĂȌ݂҂ȂB
+			sub_counts[index[0]]++;
+			sub_counts[index[1]]++;
+			sub_counts[index[2]]++;
+			sub_counts[index[3]]++;
+			sub_counts[index[4]]++;
+			sub_counts[index[5]]++;
+			sub_counts[index[6]]++;
+			sub_counts[index[7]]++;
+		}
+
+		merge_sub_histograms(sub_counts, bin_count, counts);
+		free(sub_counts);
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		float t = (a[i] - low) * inverse_width;
+		t = t >= 0.0f ? t : 0.0f;
+		t = t < last ? t : last;
+
+		counts[(int)t]++;
+	}
+}
+
+// SIMD ߂gAԂ̃qXgO߂֐B
+// Ԃ̌ߕ histogram_fixed_width_general ƓB
+void histogram_fixed_width(const float a[], int length, float low, float high, int bin_count, int counts[])
+{
+	float inverse_width = bin_count / (high - low);
+
+	memset(counts, 0, sizeof(int) * bin_count);
+
+	if (length < PARALLEL_THRESHOLD)
+	{
+		accumulate_fixed_width(a, length, low, inverse_width, bin_count, counts);
+		return;
+	}
+
+	int chunk_count = (length + CHUNK_LENGTH - 1) / CHUNK_LENGTH;
+	int allocation_failed = 0;
+
+	#pragma omp parallel
+	{
+		// XbhƂɃqXgOAŌɂ܂Ƃ߂B
+		int* partial = (int*)calloc(bin_count, sizeof(int));
+
+		if (partial == NULL)
+		{
+			#pragma omp critical
+			allocation_failed = 1;
+		}
+
+		// omp for ͑SẴXbhʂKvB
+		// 1 łmۂɎsASẴXbhĕ̏Wv߂B
+		#pragma omp barrier
+
+		if (!allocation_failed)
+		{
+			#pragma omp for schedule(static)
+			for (int chunk = 0; chunk < chunk_count; chunk++)
+			{
+				int start = chunk * CHUNK_LENGTH;
+				int chunk_length = length - start < CHUNK_LENGTH ? length - start : CHUNK_LENGTH;
+
+				accumulate_fixed_width(&a[start], chunk_length, low, inverse_width, bin_count, partial);
+			}
+
+			#pragma omp critical
+			for (int k = 0; k < bin_count; k++)
+			{
+				counts[k] += partial[k];
+			}
+		}
+
+		free(partial);
+	}
+
+	// ɏWvłȂꍇ́A1 ̃XbhŏWvB
+	if (allocation_failed)
+	{
+		accumulate_fixed_width(a, length, low, inverse_width, bin_count, counts);
+	}
+}
+
+// ėp߂gAEw肵qXgO߂֐B
+// boundaries ͏ɕ boundary_count ̋EB
+// l x ́Ax ȉ̋E̐Ԃ̔ԍƂ̂ŁAԂ boundary_count + 1 ɂȂB
+void histogram_boundaries_general(const float a[], int length, const float boundaries[], int boundary_count, int counts[])
+{
+	memset(counts, 0, sizeof(int) * (boundary_count + 1));
+
+	for (int i = 0; i < length; i++)
+	{
+		int bin = 0;
+
+		for (int j = 0; j < boundary_count; j++)
+		{
+			bin += boundaries[j] <= a[i];
+		}
+
+		counts[bin]++;
+	}
+}
+
+// SIMD ߂gAEw肵qXgO counts ɉ֐B
+// 8 ̒lɂāAɓ񕪒TB
+// EȂƂ́ASĂ̋EƔrB
+void accumulate_boundaries(const float a[], int length, const float boundaries[], int boundary_count, int counts[])
+{
+	int bin_count = boundary_count + 1;
+	int* sub_counts = (int*)calloc((size_t)bin_count * LANE_COUNT, sizeof(int));
+	int i = 0;
+
+	// boundary_count ȉ̍ő 2 ׂ̂B
+	int first_step = 1;
+
+	while (first_step * 2 <= boundary_count)
+	{
+		first_step *= 2;
+	}
+
+	if (sub_counts != NULL && boundary_count > 0)
+	{
+		__m256i one256 = _mm256_set1_epi32(1);
+		__m256i limit256 = _mm256_set1_epi32(boundary_count + 1);
+		__m256i offset256 = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(bin_count));
+
+		int index[8];
+
+		for (; i + 7 < length; i += 8)
+		{
+			__m256 a256 = _mm256_loadu_ps(&a[i]);
+
+			// base  a ȉƕĂ鋫E̐B
+			__m256i base256 = _mm256_setzero_si256();
+
+			if (boundary_count <= LINEAR_SEARCH_MAX)
+			{
+				// EȂƂ́ASĂ̋EƔrĐB
+				// Eȉ̃[ -1 Ȃ̂ŁA 1 B
+				for (int j = 0; j < boundary_count; j++)
+				{
+					__m256 less_equal256 = _mm256_cmp_ps(_mm256_set1_ps(boundaries[j]), a256, _CMP_LE_OQ);
+					base256 = _mm256_sub_epi32(base256, _mm256_castps_si256(less_equal256));
+				}
+			}
+			else
+			{
+				for (int step = first_step; step > 0; step /= 2)
+				{
+					__m256i candidate256 = _mm256_add_epi32(base256, _mm256_set1_epi32(step));
+
+					// E̐zʒu͓ǂ܂Ȃ悤ɁAǂވʒuŌ̋E܂łɎ߂B
+					__m256i in_range256 = _mm256_cmpgt_epi32(limit256, candidate256);
+					__m256i position256 = _mm256_sub_epi32(_mm256_min_epi32(candidate256, _mm256_set1_epi32(boundary_count)), one256);
+					__m256 boundary256 = _mm256_i32gather_ps(boundaries, position256, 4);
+
+					__m256i take256 = _mm256_and_si256(in_range256, _mm256_castps_si256(_mm256_cmp_ps(boundary256, a256, _CMP_LE_OQ)));
+					base256 = _mm256_blendv_epi8(base256, candidate256, take256);
+				}
+			}
+
+			_mm256_storeu_si256((__m256i*)index, _mm256_add_epi32(base256, offset256));
+
+			sub_counts[index[0]]++;
+			sub_counts[index[1]]++;
+			sub_counts[index[2]]++;
+			sub_counts[index[3]]++;
+			sub_counts[index[4]]++;
+			sub_counts[index[5]]++;
+			sub_counts[index[6]]++;
+			sub_counts[index[7]]++;
+		}
+
+		merge_sub_histograms(sub_counts, bin_count, counts);
+	}
+
+	free(sub_counts);
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		int base = 0;
+
+		for (int step = first_step; step > 0; step /= 2)
+		{
+			if (base + step <= boundary_count && boundaries[base + step - 1] <= a[i])
+			{
+				base += step;
+			}
+		}
+
+		counts[base]++;
+	}
+}
+
+// SIMD ߂gAEw肵qXgO߂֐B
+// Ԃ̌ߕ histogram_boundaries_general ƓB
+void histogram_boundaries(const float a[], int length, const float boundaries[], int boundary_count, int counts[])
+{
+	int bin_count = boundary_count + 1;
+
+	memset(counts, 0, sizeof(int) * bin_count);
+
+	if (length < PARALLEL_THRESHOLD)
+	{
+		accumulate_boundaries(a, length, boundaries, boundary_count, counts);
+		return;
+	}
+
+	int chunk_count = (length + CHUNK_LENGTH - 1) / CHUNK_LENGTH;
+	int allocation_failed = 0;
+
+	#pragma omp parallel
+	{
+		int* partial = (int*)calloc(bin_count, sizeof(int));
+
+		if (partial == NULL)
+		{
+			#pragma omp critical
+			allocation_failed = 1;
+		}
+
+		// omp for ͑SẴXbhʂKvB
+		// 1 łmۂɎsASẴXbhĕ̏Wv߂B
+		#pragma omp barrier
+
+		if (!allocation_failed)
+		{
+			#pragma omp for schedule(static)
+			for (int chunk = 0; chunk < chunk_count; chunk++)
+			{
+				int start = chunk * CHUNK_LENGTH;
+				int chunk_length = length - start < CHUNK_LENGTH ? length - start : CHUNK_LENGTH;
+
+				accumulate_boundaries(&a[start], chunk_length, boundaries, boundary_count, partial);
+			}
+
+			#pragma omp critical
+			for (int k = 0; k < bin_count; k++)
+			{
+				counts[k] += partial[k];
+			}
+		}
+
+		free(partial);
+	}
+
+	// ɏWvłȂꍇ́A1 ̃XbhŏWvB
+	if (allocation_failed)
+	{
+		accumulate_boundaries(a, length, boundaries, boundary_count, counts);
+	}
+}
+
+// ėp߂gAel̏o񐔂߂֐B
+// l 0 ȏ domain ł邱ƁB
+void count_values_general(const int a[], int length, int domain, int counts[])
+{
+	memset(counts, 0, sizeof(int) * domain);
+
+	for (int i = 0; i < length; i++)
+	{
+		counts[a[i]]++;
+	}
+}
+
+// SIMD ߂gAel̏o񐔂 counts ɉ֐B
+void accumulate_values(const int a[], int length, int domain, int counts[])
+{
+	int i = 0;
+
+	if (domain <= SMALL_DOMAIN)
+	{
+		// l̎ނȂƂ́AlƂɔrĐB
+		// ւ݂̏Ȃ̂ŁAlĂxȂȂB
+		int block_end = length - length % 8;
+
+		for (int block = 0; block < block_end; block += SMALL_DOMAIN_BLOCK)
+		{
+			int end = block + SMALL_DOMAIN_BLOCK < block_end ? block + SMALL_DOMAIN_BLOCK : block_end;
+
+			for (int v = 0; v < domain; v++)
+			{
+				__m256i value256 = _mm256_set1_epi32(v);
+				__m256i count256 = _mm256_setzero_si256();
+
+				for (int j = block; j < end; j += 8)
+				{
+					__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[j]));
+
+					// v[ -1 Ȃ̂ŁA 1 B
+					count256 = _mm256_sub_epi32(count256, _mm256_cmpeq_epi32(a256, value256));
+				}
+
+				// XJ[lɕϊB
+				__m256i count256_permute = _mm256_permute2x128_si256(count256, count256, 1);
+				__m256i result256 = _mm256_hadd_epi32(count256, count256_permute);
+				result256 = _mm256_hadd_epi32(result256, result256);
+				result256 = _mm256_hadd_epi32(result256, result256);
+				counts[v] += _mm256_extract_epi32(result256, 0);
+			}
+		}
+
+		i = block_end;
+	}
+	else
+	{
+		int* sub_counts = (int*)calloc((size_t)domain * LANE_COUNT, sizeof(int));
+
+		if (sub_counts != NULL)
+		{
+			__m256i offset256 = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(domain));
+
+			int index[8];
+
+			for (; i + 7 < length; i += 8)
+			{
+				__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+				_mm256_storeu_si256((__m256i*)index, _mm256_add_epi32(a256, offset256));
+
+				sub_counts[index[0]]++;
+				sub_counts[index[1]]++;
+				sub_counts[index[2]]++;
+				sub_counts[index[3]]++;
+				sub_counts[index[4]]++;
+				sub_counts[index[5]]++;
+				sub_counts[index[6]]++;
+				sub_counts[index[7]]++;
+			}
+
+			merge_sub_histograms(sub_counts, domain, counts);
+			free(sub_counts);
+		}
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		counts[a[i]]++;
+	}
+}
+
+// SIMD ߂gAel̏o񐔂߂֐B
+// l 0 ȏ domain ł邱ƁB
+void count_values(const int a[], int length, int domain, int counts[])
+{
+	memset(counts, 0, sizeof(int) * domain);
+
+	if (length < PARALLEL_THRESHOLD)
+	{
+		accumulate_values(a, length, domain, counts);
+		return;
+	}
+
+	int chunk_count = (length + CHUNK_LENGTH - 1) / CHUNK_LENGTH;
+	int allocation_failed = 0;
+
+	#pragma omp parallel
+	{
+		int* partial = (int*)calloc(domain, sizeof(int));
+
+		if (partial == NULL)
+		{
+			#pragma omp critical
+			allocation_failed = 1;
+		}
+
+		// omp for ͑SẴXbhʂKvB
+		// 1 łmۂɎsASẴXbhĕ̏Wv߂B
+		#pragma omp barrier
+
+		if (!allocation_failed)
+		{
+			#pragma omp for schedule(static)
+			for (int chunk = 0; chunk < chunk_count; chunk++)
+			{
+				int start = chunk * CHUNK_LENGTH;
+				int chunk_length = length - start < CHUNK_LENGTH ? length - start : CHUNK_LENGTH;
+
+				accumulate_values(&a[start], chunk_length, domain, partial);
+			}
+
+			#pragma omp critical
+			for (int v = 0; v < domain; v++)
+			{
+				counts[v] += partial[v];
+			}
+		}
+
+		free(partial);
+	}
+
+	// ɏWvłȂꍇ́A1 ̃XbhŏWvB
+	if (allocation_failed)
+	{
+		accumulate_values(a, length, domain, counts);
+	}
+}
+
+void print_counts(const char* name, const int counts[], int bin_count)
+{
+	printf("%s", name);
+
+	for (int k = 0; k < bin_count; k++)
+	{
+		printf(" %d", counts[k]);
+	}
+
+	printf("\n");
+}
+
+int main(void)
+{
+	float a[] = { 0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 9.9f, -1.0f, 12.0f, 5.0f, 5.5f, 7.25f, 2.0f, 2.1f };
+	int length = sizeof(a) / sizeof(float);
+	float boundaries[] = { 1.0f, 2.0f, 5.0f, 10.0f };
+	int boundary_count = sizeof(boundaries) / sizeof(float);
+	int b[] = { 0, 1, 2, 3, 3, 2, 1, 0, 0, 0, 5, 4, 3 };
+	int b_length = sizeof(b) / sizeof(int);
+	int counts[16];
+
+	// LINEAR_SEARCH_MAX 𒴂鋫ÉA񕪒TŋԂ߂B
+	// ԊułȂ 20 ̋Ei0, 0.25, 1, 2.25, 4, ..., 90.25jB
+	float many_boundaries[20];
+	int many_boundary_count = sizeof(many_boundaries) / sizeof(float);
+	int many_counts[21];
+	int many_counts_general[21];
+
+	for (int j = 0; j < many_boundary_count; j++)
+	{
+		many_boundaries[j] = 0.25f * j * j;
+	}
+
+	histogram_fixed_width_general(a, length, 0.0f, 10.0f, 5, counts);
+	print_counts("histogram_fixed_width_general:", counts, 5);
+
+	histogram_fixed_width(a, length, 0.0f, 10.0f, 5, counts);
+	print_counts("histogram_fixed_width        :", counts, 5);
+
+	histogram_boundaries_general(a, length, boundaries, boundary_count, counts);
+	print_counts("histogram_boundaries_general :", counts, boundary_count + 1);
+
+	histogram_boundaries(a, length, boundaries, boundary_count, counts);
+	print_counts("histogram_boundaries         :", counts, boundary_count + 1);
+
+	histogram_boundaries_general(a, length, many_boundaries, many_boundary_count, many_counts_general);
+	print_counts("histogram_boundaries_general (20 boundaries):", many_counts_general, many_boundary_count + 1);
+
+	histogram_boundaries(a, length, many_boundaries, many_boundary_count, many_counts);
+	print_counts("histogram_boundaries         (20 boundaries):", many_counts, many_boundary_count + 1);
+
+	count_values_general(b, b_length, 6, counts);
+	print_counts("count_values_general         :", counts, 6);
+
+	count_values(b, b_length, 6, counts);
+	print_counts("count_values                 :", counts, 6);
+
+	// 傫ȔzőxrB
+	// l΂ĂāAԂ₷ꍇB
+	int large_length = 1 << 24;
+	float* large_a = (float*)malloc(sizeof(float) * large_length);
+	int* large_b = (int*)malloc(sizeof(int) * large_length);
+	int large_counts[256];
+
+	if (large_a == NULL || large_b == NULL)
+	{
+		free(large_a);
+		free(large_b);
+		return 1;
+	}
+
+	for (int i = 0; i < large_length; i++)
+	{
+		large_a[i] = (float)((i * 2654435761u) % 1000) / 1000.0f * ((i % 8) == 0 ? 100.0f : 10.0f);
+		large_b[i] = (i % 16) == 0 ? (int)((i * 2654435761u) >> 24) : 0;
+	}
+
+	clock_t start = clock();
+	histogram_fixed_width_general(large_a, large_length, 0.0f, 100.0f, 100, large_counts);
+	printf("\nhistogram_fixed_width_general: %d (%ld ms)\n", large_counts[0], (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	histogram_fixed_width(large_a, large_length, 0.0f, 100.0f, 100, large_counts);
+	printf("histogram_fixed_width        : %d (%ld ms)\n", large_counts[0], (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	histogram_boundaries_general(large_a, large_length, boundaries, boundary_count, large_counts);
+	printf("histogram_boundaries_general : %d (%ld ms)\n", large_counts[0], (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	histogram_boundaries(large_a, large_length, boundaries, boundary_count, large_counts);
+	printf("histogram_boundaries         : %d (%ld ms)\n", large_counts[0], (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	histogram_boundaries_general(large_a, large_length, many_boundaries, many_boundary_count, many_counts_general);
+	printf("histogram_boundaries_general (20 boundaries): %d (%ld ms)\n", many_counts_general[0], (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	histogram_boundaries(large_a, large_length, many_boundaries, many_boundary_count, many_counts);
+	printf("histogram_boundaries         (20 boundaries): %d (%ld ms)\n", many_counts[0], (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+	printf("result                       (20 boundaries): %s\n", memcmp(many_counts, many_counts_general, sizeof(many_counts)) == 0 ? "OK" : "NG");
+
+	start = clock();
+	count_values_general(large_b, large_length, 256, large_counts);
+	printf("count_values_general         : %d (%ld ms)\n", large_counts[0], (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	count_values(large_b, large_length, 256, large_counts);
+	printf("count_values                 : %d (%ld ms)\n", large_counts[0], (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	free(large_a);
+	free(large_b);
+
+	return 0;
+}
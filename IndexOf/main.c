@@ -4,6 +4,8 @@
 // https://zenn.dev/k_taro56/articles/simd-index-of-array
 
 #include <stdio.h>
+#include <stdint.h>
+#include <string.h>
 #include <intrin.h>
 
 // 32 ビット符号付整数の 8 個の要素を持つベクトルの中から、最初に負の要素が見つかったインデックスを求める関数。
@@ -126,6 +128,329 @@ int index_of_fast(const int a[], int length, int key)
 	return -1;
 }
 
+// 8 ビット整数の 32 個の要素を持つベクトルの中から、最初に最上位ビットが 1 の要素が見つかったインデックスを求める関数。
+unsigned long find_first_non_zero_index_epi8(__m256i a)
+{
+	unsigned long index;
+	int mask = _mm256_movemask_epi8(a);
+	_BitScanForward(&index, mask);
+	return index;
+}
+
+// 汎用命令を使った、配列 a の中から key と等しい 8 ビットの要素のインデックスを求める関数。
+int index_of_general_epi8(const char a[], int length, char key)
+{
+	for (int i = 0; i < length; i++)
+	{
+		if (key == a[i])
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+// SIMD 命令を使った、配列 a の中から key と等しい 8 ビットの要素のインデックスを求める関数。
+int index_of_epi8(const char a[], int length, char key)
+{
+	if (length <= 0)
+	{
+		return -1;
+	}
+
+	int i = 0;
+
+	__m256i key256 = _mm256_set1_epi8(key);
+
+	// 各要素を 32 個ずつ処理。
+	for (; i + 31 < length; i += 32)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i equals256 = _mm256_cmpeq_epi8(a256, key256);
+
+		// 32 個の要素の中に key と等しい要素があるかどうかを判定。
+		if (!_mm256_testz_si256(equals256, equals256))
+		{
+			return i + find_first_non_zero_index_epi8(equals256);
+		}
+	}
+
+	// 残りの要素を処理。
+	// 32 バイト境界に揃えた位置から読み込む。
+	// 境界に揃えた 32 バイトはページをまたがないので、配列の外を読んでも例外にならない。
+	// 配列の範囲外の結果はマスクで取り除く。
+	const char* end = a + length;
+	const char* p = a + i;
+
+	while (p < end)
+	{
+		const char* block = (const char*)((uintptr_t)p & ~(uintptr_t)31);
+		__m256i a256 = _mm256_load_si256((const __m256i*)block);
+		unsigned int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(a256, key256));
+
+		// p より前と end 以降の要素を取り除く。
+		mask &= 0xFFFFFFFFu << (p - block);
+
+		if (end - block < 32)
+		{
+			mask &= (1u << (end - block)) - 1;
+		}
+
+		if (mask != 0)
+		{
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return (int)(block - a) + (int)index;
+		}
+
+		p = block + 32;
+	}
+
+	return -1;
+}
+
+// 汎用命令を使った、配列 a の中から key と等しい 16 ビットの要素のインデックスを求める関数。
+int index_of_general_epi16(const short a[], int length, short key)
+{
+	for (int i = 0; i < length; i++)
+	{
+		if (key == a[i])
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+// SIMD 命令を使った、配列 a の中から key と等しい 16 ビットの要素のインデックスを求める関数。
+// 比較結果は 1 要素 2 バイトなので、movemask のビット位置を 2 で割るとインデックスになる。
+int index_of_epi16(const short a[], int length, short key)
+{
+	if (length <= 0)
+	{
+		return -1;
+	}
+
+	int i = 0;
+
+	__m256i key256 = _mm256_set1_epi16(key);
+
+	// 各要素を 16 個ずつ処理。
+	for (; i + 15 < length; i += 16)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i equals256 = _mm256_cmpeq_epi16(a256, key256);
+
+		if (!_mm256_testz_si256(equals256, equals256))
+		{
+			return i + find_first_non_zero_index_epi8(equals256) / 2;
+		}
+	}
+
+	// 残りの要素を処理。
+	// index_of_epi8 と同じく、32 バイト境界に揃えた位置から読み込む。
+	const char* end = (const char*)(a + length);
+	const char* p = (const char*)(a + i);
+
+	while (p < end)
+	{
+		const char* block = (const char*)((uintptr_t)p & ~(uintptr_t)31);
+		__m256i a256 = _mm256_load_si256((const __m256i*)block);
+		unsigned int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi16(a256, key256));
+
+		mask &= 0xFFFFFFFFu << (p - block);
+
+		if (end - block < 32)
+		{
+			mask &= (1u << (end - block)) - 1;
+		}
+
+		if (mask != 0)
+		{
+			unsigned long index;
+			_BitScanForward(&index, mask);
+			return (int)((block + index - (const char*)a) / 2);
+		}
+
+		p = block + 32;
+	}
+
+	return -1;
+}
+
+// SIMD 命令を使った、配列 a の中から key と等しい 8 ビットの要素のインデックスを全て求める関数。
+// 見つかったインデックスを、最大 max_count 個まで indexes に書き込み、その個数を返す。
+int find_all_epi8(const char a[], int length, char key, int indexes[], int max_count)
+{
+	int count = 0;
+	int i = 0;
+
+	__m256i key256 = _mm256_set1_epi8(key);
+
+	for (; i + 31 < length; i += 32)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		unsigned int mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(a256, key256));
+
+		// 立っているビットを下から順に取り出す。
+		while (mask != 0)
+		{
+			unsigned long index;
+			_BitScanForward(&index, mask);
+
+			if (count == max_count)
+			{
+				return count;
+			}
+
+			indexes[count++] = i + index;
+			mask &= mask - 1;
+		}
+	}
+
+	// 残りの要素を処理。
+	// ここは汎用命令。
+	for (; i < length && count < max_count; i++)
+	{
+		if (key == a[i])
+		{
+			indexes[count++] = i;
+		}
+	}
+
+	return count;
+}
+
+// 汎用命令を使った、文字列 text の中から pattern が最初に現れる位置を求める関数。
+int index_of_substring_general(const char text[], int length, const char pattern[], int pattern_length)
+{
+	for (int i = 0; i + pattern_length <= length; i++)
+	{
+		if (memcmp(&text[i], pattern, pattern_length) == 0)
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+// SIMD 命令を使った、text[start] 以降で pattern の最初と最後のバイトが一致する位置のマスクを求める関数。
+// ビット j が 1 なら、text[start + j] から pattern が始まる可能性がある。
+unsigned int match_first_last_epi8(const char text[], int start, int pattern_length, __m256i first256, __m256i last256)
+{
+	__m256i first_block256 = _mm256_loadu_si256((__m256i*)(&text[start]));
+	__m256i last_block256 = _mm256_loadu_si256((__m256i*)(&text[start + pattern_length - 1]));
+	__m256i equals256 = _mm256_and_si256(_mm256_cmpeq_epi8(first_block256, first256), _mm256_cmpeq_epi8(last_block256, last256));
+
+	return _mm256_movemask_epi8(equals256);
+}
+
+// SIMD 命令を使った、文字列 text の中から pattern が最初に現れる位置を求める関数。
+// 最初と最後のバイトで 32 か所の候補を同時に絞り込み、残った候補だけを memcmp で確かめる。
+int index_of_substring(const char text[], int length, const char pattern[], int pattern_length)
+{
+	if (pattern_length <= 0)
+	{
+		return 0;
+	}
+
+	if (pattern_length == 1)
+	{
+		return index_of_epi8(text, length, pattern[0]);
+	}
+
+	__m256i first256 = _mm256_set1_epi8(pattern[0]);
+	__m256i last256 = _mm256_set1_epi8(pattern[pattern_length - 1]);
+
+	int i = 0;
+
+	for (; i + pattern_length + 30 < length; i += 32)
+	{
+		unsigned int mask = match_first_last_epi8(text, i, pattern_length, first256, last256);
+
+		while (mask != 0)
+		{
+			unsigned long index;
+			_BitScanForward(&index, mask);
+
+			// 最初と最後のバイトは一致しているので、間だけを比べる。
+			if (memcmp(&text[i + index + 1], &pattern[1], pattern_length - 2) == 0)
+			{
+				return i + index;
+			}
+
+			mask &= mask - 1;
+		}
+	}
+
+	// 残りの要素を処理。
+	// ここは汎用命令。
+	for (; i + pattern_length <= length; i++)
+	{
+		if (memcmp(&text[i], pattern, pattern_length) == 0)
+		{
+			return i;
+		}
+	}
+
+	return -1;
+}
+
+// SIMD 命令を使った、文字列 text の中から pattern が現れる位置を全て求める関数。
+// 重なって現れる場合も全て数える。
+// 見つかった位置を、最大 max_count 個まで indexes に書き込み、その個数を返す。
+int find_all_substring(const char text[], int length, const char pattern[], int pattern_length, int indexes[], int max_count)
+{
+	if (pattern_length <= 0)
+	{
+		return 0;
+	}
+
+	__m256i first256 = _mm256_set1_epi8(pattern[0]);
+	__m256i last256 = _mm256_set1_epi8(pattern[pattern_length - 1]);
+
+	int count = 0;
+	int i = 0;
+
+	for (; i + pattern_length + 30 < length; i += 32)
+	{
+		unsigned int mask = match_first_last_epi8(text, i, pattern_length, first256, last256);
+
+		while (mask != 0)
+		{
+			unsigned long index;
+			_BitScanForward(&index, mask);
+
+			if (pattern_length < 2 || memcmp(&text[i + index + 1], &pattern[1], pattern_length - 2) == 0)
+			{
+				if (count == max_count)
+				{
+					return count;
+				}
+
+				indexes[count++] = i + index;
+			}
+
+			mask &= mask - 1;
+		}
+	}
+
+	// 残りの要素を処理。
+	// ここは汎用命令。
+	for (; i + pattern_length <= length && count < max_count; i++)
+	{
+		if (memcmp(&text[i], pattern, pattern_length) == 0)
+		{
+			indexes[count++] = i;
+		}
+	}
+
+	return count;
+}
+
 int main(void)
 {
 	int a[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0 };
@@ -164,5 +489,50 @@ int main(void)
 	index = index_of_fast(a, length, key);
 	printf("index_of_fast:    key = %d, index = %d\n", key, index);
 
+	char text[] = "GET /index.html HTTP/1.1\r\nHost: example.com\r\nAccept: */*\r\n\r\n";
+	int text_length = (int)strlen(text);
+	short codes[] = { 100, 200, 201, 204, 301, 302, 304, 400, 401, 403, 404, 500, 502, 503, 504 };
+	int codes_length = sizeof(codes) / sizeof(short);
+	int indexes[16];
+	int count;
+
+	printf("\n");
+
+	index = index_of_general_epi8(text, text_length, ':');
+	printf("index_of_general_epi8:      key = ':', index = %d\n", index);
+
+	index = index_of_epi8(text, text_length, ':');
+	printf("index_of_epi8:              key = ':', index = %d\n", index);
+
+	index = index_of_general_epi16(codes, codes_length, 404);
+	printf("index_of_general_epi16:     key = 404, index = %d\n", index);
+
+	index = index_of_epi16(codes, codes_length, 404);
+	printf("index_of_epi16:             key = 404, index = %d\n", index);
+
+	index = index_of_substring_general(text, text_length, "Host:", 5);
+	printf("index_of_substring_general: \"Host:\", index = %d\n", index);
+
+	index = index_of_substring(text, text_length, "Host:", 5);
+	printf("index_of_substring:         \"Host:\", index = %d\n", index);
+
+	count = find_all_epi8(text, text_length, '\n', indexes, 16);
+	printf("find_all_epi8:              key = '\\n', indexes =");
+
+	for (int i = 0; i < count; i++)
+	{
+		printf(" %d", indexes[i]);
+	}
+	printf("\n");
+
+	count = find_all_substring(text, text_length, "\r\n", 2, indexes, 16);
+	printf("find_all_substring:         \"\\r\\n\", indexes =");
+
+	for (int i = 0; i < count; i++)
+	{
+		printf(" %d", indexes[i]);
+	}
+	printf("\n");
+
 	return 0;
 }
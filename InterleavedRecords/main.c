@@ -0,0 +1,483 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include <intrin.h>
+
+// \̂̔ziAoSĵ܂܁A2 ̃tB[h̓ρAUA֌W߂TvB
+// z𕪊ăRs[Aǂݍ񂾃WX^̒ŃtB[hƂɕבւB
+// MU[߂͎gȂB
+//
+// data  int  stride 񂾃R[h̔zŁA
+// offset_a  offset_b ̓R[h̒ł̃tB[ḧʒuB
+// stride  2  3 ̂Ƃ SIMD ߂gAȊO͔ėp߂ŏB
+
+// x, y ̑gB
+typedef struct
+{
+	int x;
+	int y;
+} point;
+
+// AlA^ȎgB
+typedef struct
+{
+	int timestamp;
+	int value;
+	int tag;
+} record;
+
+// 8 ̃R[h 2 ̃tB[ho߂̏B
+typedef struct
+{
+	int stride;
+
+	// stride  2 ̂ƂɎgבւ̈ʒuB
+	__m256i permute_index256;
+
+	// stride  3 ̂ƂɎguh̃}XNƕבւ̈ʒuB
+	__m256i blend_mask_a256[2];
+	__m256i blend_mask_b256[2];
+	__m256i permute_index_a256;
+	__m256i permute_index_b256;
+} field_loader;
+
+// SIMD ߂ŏł stride ǂ𔻒肷֐B
+int is_supported_stride(int stride)
+{
+	return stride == 2 || stride == 3;
+}
+
+// field_loader ֐B
+void init_field_loader(field_loader* loader, int stride, int offset_a, int offset_b)
+{
+	loader->stride = stride;
+
+	if (stride == 2)
+	{
+		// 4 ̃R[hWX^A 128 rbg aA 128 rbg b W߂B
+		loader->permute_index256 = _mm256_setr_epi32(
+			offset_a, offset_a + 2, offset_a + 4, offset_a + 6,
+			offset_b, offset_b + 2, offset_b + 4, offset_b + 6);
+	}
+	else if (stride == 3)
+	{
+		// 8 ̃R[h 3 ̃WX^ v0, v1, v2 ɂ܂B
+		// R[h k ̃tB[h f ́A擪 3k + f ԖڂɂB
+		// ʒu p ̗vf́Aǂ̃WX^ł[ p % 8 ɂA[dȂȂB
+		// ̂߁A2 ̃uh 1 ̃WX^ɏW߁A1 ̕בւŃR[hɒB
+		int mask_a[2][8];
+		int mask_b[2][8];
+		int index_a[8];
+		int index_b[8];
+
+		for (int lane = 0; lane < 8; lane++)
+		{
+			for (int j = 0; j < 2; j++)
+			{
+				int position = (j + 1) * 8 + lane;
+				mask_a[j][lane] = position % 3 == offset_a ? -1 : 0;
+				mask_b[j][lane] = position % 3 == offset_b ? -1 : 0;
+			}
+
+			index_a[lane] = (lane * 3 + offset_a) % 8;
+			index_b[lane] = (lane * 3 + offset_b) % 8;
+		}
+
+		for (int j = 0; j < 2; j++)
+		{
+			loader->blend_mask_a256[j] = _mm256_loadu_si256((__m256i*)mask_a[j]);
+			loader->blend_mask_b256[j] = _mm256_loadu_si256((__m256i*)mask_b[j]);
+		}
+
+		loader->permute_index_a256 = _mm256_loadu_si256((__m256i*)index_a);
+		loader->permute_index_b256 = _mm256_loadu_si256((__m256i*)index_b);
+	}
+}
+
+// 8 ̃R[h 2 ̃tB[ho֐B
+void load_fields(const field_loader* loader, const int* p, __m256i* a256, __m256i* b256)
+{
+	if (loader->stride == 2)
+	{
+		__m256i v0 = _mm256_loadu_si256((__m256i*)(&p[0]));
+		__m256i v1 = _mm256_loadu_si256((__m256i*)(&p[8]));
+
+		// eWX^̒ŁAa ʁAb ʂɏW߂B
+		v0 = _mm256_permutevar8x32_epi32(v0, loader->permute_index256);
+		v1 = _mm256_permutevar8x32_epi32(v1, loader->permute_index256);
+
+		*a256 = _mm256_permute2x128_si256(v0, v1, 0x20);
+		*b256 = _mm256_permute2x128_si256(v0, v1, 0x31);
+	}
+	else
+	{
+		__m256i v0 = _mm256_loadu_si256((__m256i*)(&p[0]));
+		__m256i v1 = _mm256_loadu_si256((__m256i*)(&p[8]));
+		__m256i v2 = _mm256_loadu_si256((__m256i*)(&p[16]));
+
+		__m256i a = _mm256_blendv_epi8(v0, v1, loader->blend_mask_a256[0]);
+		a = _mm256_blendv_epi8(a, v2, loader->blend_mask_a256[1]);
+		*a256 = _mm256_permutevar8x32_epi32(a, loader->permute_index_a256);
+
+		__m256i b = _mm256_blendv_epi8(v0, v1, loader->blend_mask_b256[0]);
+		b = _mm256_blendv_epi8(b, v2, loader->blend_mask_b256[1]);
+		*b256 = _mm256_permutevar8x32_epi32(b, loader->permute_index_b256);
+	}
+}
+
+// 8 ̗vf̘a߂֐B
+int reduce_add_epi32(__m256i a256)
+{
+	__m256i a256_permute = _mm256_permute2x128_si256(a256, a256, 1);
+	__m256i sum256 = _mm256_hadd_epi32(a256, a256_permute);
+	sum256 = _mm256_hadd_epi32(sum256, sum256);
+	sum256 = _mm256_hadd_epi32(sum256, sum256);
+	return _mm256_extract_epi32(sum256, 0);
+}
+
+// ėp߂gAR[h 2 ̃tB[h̓ς߂֐B
+int dot_product_strided_general(const int data[], int stride, int offset_a, int offset_b, int length)
+{
+	int dot_product = 0;
+
+	for (int i = 0; i < length; i++)
+	{
+		const int* p = &data[i * stride];
+		dot_product += p[offset_a] * p[offset_b];
+	}
+
+	return dot_product;
+}
+
+// SIMD ߂gAR[h 2 ̃tB[h̓ς߂֐B
+int dot_product_strided(const int data[], int stride, int offset_a, int offset_b, int length)
+{
+	if (!is_supported_stride(stride))
+	{
+		return dot_product_strided_general(data, stride, offset_a, offset_b, length);
+	}
+
+	field_loader loader;
+	init_field_loader(&loader, stride, offset_a, offset_b);
+
+	int i = 0;
+
+	// v 0 ŏB
+	__m256i dot_product256 = _mm256_setzero_si256();
+
+	// eR[h 8 B
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256;
+		__m256i b256;
+		load_fields(&loader, &data[i * stride], &a256, &b256);
+
+		dot_product256 = _mm256_add_epi32(dot_product256, _mm256_mullo_epi32(a256, b256));
+	}
+
+	int dot_product = reduce_add_epi32(dot_product256);
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		const int* p = &data[i * stride];
+		dot_product += p[offset_a] * p[offset_b];
+	}
+
+	return dot_product;
+}
+
+// ėp߂gAR[h 2 ̃tB[h̋U߂֐B
+double covariance_strided_general(const int data[], int stride, int offset_a, int offset_b, int length)
+{
+	int multiply_add = 0;
+	int sum_a = 0;
+	int sum_b = 0;
+
+	for (int i = 0; i < length; i++)
+	{
+		const int* p = &data[i * stride];
+		multiply_add += p[offset_a] * p[offset_b];
+		sum_a += p[offset_a];
+		sum_b += p[offset_b];
+	}
+
+	double average_multiply = (double)multiply_add / length;
+	double average_a = (double)sum_a / length;
+	double average_b = (double)sum_b / length;
+
+	return average_multiply - (average_a * average_b);
+}
+
+// SIMD ߂gAR[h 2 ̃tB[h̋U߂֐B
+double covariance_strided(const int data[], int stride, int offset_a, int offset_b, int length)
+{
+	if (!is_supported_stride(stride))
+	{
+		return covariance_strided_general(data, stride, offset_a, offset_b, length);
+	}
+
+	field_loader loader;
+	init_field_loader(&loader, stride, offset_a, offset_b);
+
+	int i = 0;
+
+	// vl 0 ŏB
+	__m256i multiply_add256 = _mm256_setzero_si256();
+	__m256i sum_a256 = _mm256_setzero_si256();
+	__m256i sum_b256 = _mm256_setzero_si256();
+
+	// eR[h 8 B
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256;
+		__m256i b256;
+		load_fields(&loader, &data[i * stride], &a256, &b256);
+
+		multiply_add256 = _mm256_add_epi32(multiply_add256, _mm256_mullo_epi32(a256, b256));
+		sum_a256 = _mm256_add_epi32(sum_a256, a256);
+		sum_b256 = _mm256_add_epi32(sum_b256, b256);
+	}
+
+	int multiply_add = reduce_add_epi32(multiply_add256);
+	int sum_a = reduce_add_epi32(sum_a256);
+	int sum_b = reduce_add_epi32(sum_b256);
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		const int* p = &data[i * stride];
+		multiply_add += p[offset_a] * p[offset_b];
+		sum_a += p[offset_a];
+		sum_b += p[offset_b];
+	}
+
+	double average_multiply = (double)multiply_add / length;
+	double average_a = (double)sum_a / length;
+	double average_b = (double)sum_b / length;
+
+	return average_multiply - (average_a * average_b);
+}
+
+// a瑊֌W߂֐B
+double correlation_coefficient_from_sums(int multiply_add, int sum_a, int sum_b, int squared_sum_a, int squared_sum_b, int length)
+{
+	// ςvZB
+	double average_multiply = (double)multiply_add / length;
+
+	double average_a = (double)sum_a / length;
+	double average_b = (double)sum_b / length;
+
+	double average_square_a = (double)squared_sum_a / length;
+	double average_square_b = (double)squared_sum_b / length;
+
+	// UvZB
+	double variance_a = average_square_a - (average_a * average_a);
+	double variance_b = average_square_b - (average_b * average_b);
+
+	// UvZB
+	double covariance = average_multiply - (average_a * average_b);
+
+	return covariance / (sqrt(variance_a) * sqrt(variance_b));
+}
+
+// ėp߂gAR[h 2 ̃tB[h̑֌W߂֐B
+double correlation_coefficient_strided_general(const int data[], int stride, int offset_a, int offset_b, int length)
+{
+	int multiply_add = 0;
+
+	int sum_a = 0;
+	int sum_b = 0;
+
+	int squared_sum_a = 0;
+	int squared_sum_b = 0;
+
+	for (int i = 0; i < length; i++)
+	{
+		const int* p = &data[i * stride];
+		int a = p[offset_a];
+		int b = p[offset_b];
+
+		multiply_add += a * b;
+
+		sum_a += a;
+		sum_b += b;
+
+		squared_sum_a += a * a;
+		squared_sum_b += b * b;
+	}
+
+	return correlation_coefficient_from_sums(multiply_add, sum_a, sum_b, squared_sum_a, squared_sum_b, length);
+}
+
+// SIMD ߂gAR[h 2 ̃tB[h̑֌W߂֐B
+double correlation_coefficient_strided(const int data[], int stride, int offset_a, int offset_b, int length)
+{
+	if (!is_supported_stride(stride))
+	{
+		return correlation_coefficient_strided_general(data, stride, offset_a, offset_b, length);
+	}
+
+	field_loader loader;
+	init_field_loader(&loader, stride, offset_a, offset_b);
+
+	int i = 0;
+
+	// vl 0 ŏB
+	__m256i multiply_add256 = _mm256_setzero_si256();
+
+	__m256i sum_a256 = _mm256_setzero_si256();
+	__m256i sum_b256 = _mm256_setzero_si256();
+
+	__m256i squared_sum_a256 = _mm256_setzero_si256();
+	__m256i squared_sum_b256 = _mm256_setzero_si256();
+
+	// eR[h 8 B
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256;
+		__m256i b256;
+		load_fields(&loader, &data[i * stride], &a256, &b256);
+
+		multiply_add256 = _mm256_add_epi32(multiply_add256, _mm256_mullo_epi32(a256, b256));
+
+		sum_a256 = _mm256_add_epi32(sum_a256, a256);
+		sum_b256 = _mm256_add_epi32(sum_b256, b256);
+
+		squared_sum_a256 = _mm256_add_epi32(squared_sum_a256, _mm256_mullo_epi32(a256, a256));
+		squared_sum_b256 = _mm256_add_epi32(squared_sum_b256, _mm256_mullo_epi32(b256, b256));
+	}
+
+	int multiply_add = reduce_add_epi32(multiply_add256);
+
+	int sum_a = reduce_add_epi32(sum_a256);
+	int sum_b = reduce_add_epi32(sum_b256);
+
+	int squared_sum_a = reduce_add_epi32(squared_sum_a256);
+	int squared_sum_b = reduce_add_epi32(squared_sum_b256);
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		const int* p = &data[i * stride];
+		int a = p[offset_a];
+		int b = p[offset_b];
+
+		multiply_add += a * b;
+
+		sum_a += a;
+		sum_b += b;
+
+		squared_sum_a += a * a;
+		squared_sum_b += b * b;
+	}
+
+	return correlation_coefficient_from_sums(multiply_add, sum_a, sum_b, squared_sum_a, squared_sum_b, length);
+}
+
+// point ̔z x  y ̓ς߂֐B
+int dot_product_points(const point points[], int length)
+{
+	return dot_product_strided(&points[0].x, 2, 0, 1, length);
+}
+
+// point ̔z x  y ̋U߂֐B
+double covariance_points(const point points[], int length)
+{
+	return covariance_strided(&points[0].x, 2, 0, 1, length);
+}
+
+// point ̔z x  y ̑֌W߂֐B
+double correlation_coefficient_points(const point points[], int length)
+{
+	return correlation_coefficient_strided(&points[0].x, 2, 0, 1, length);
+}
+
+// record ̔z̎ƒl̋U߂֐B
+double covariance_records(const record records[], int length)
+{
+	return covariance_strided(&records[0].timestamp, 3, 0, 1, length);
+}
+
+// record ̔z̎ƒl̑֌W߂֐B
+double correlation_coefficient_records(const record records[], int length)
+{
+	return correlation_coefficient_strided(&records[0].timestamp, 3, 0, 1, length);
+}
+
+int main(void)
+{
+	point points[] =
+	{
+		{ 1, 9 }, { 2, 8 }, { 3, 7 }, { 4, 6 }, { 5, 5 },
+		{ 6, 4 }, { 7, 3 }, { 8, 2 }, { 9, 1 },
+	};
+	int point_length = sizeof(points) / sizeof(points[0]);
+
+	printf("dot_product_strided_general:             %d\n", dot_product_strided_general(&points[0].x, 2, 0, 1, point_length));
+	printf("dot_product_points:                      %d\n", dot_product_points(points, point_length));
+	printf("covariance_strided_general:              %lf\n", covariance_strided_general(&points[0].x, 2, 0, 1, point_length));
+	printf("covariance_points:                       %lf\n", covariance_points(points, point_length));
+	printf("correlation_coefficient_strided_general: %lf\n", correlation_coefficient_strided_general(&points[0].x, 2, 0, 1, point_length));
+	printf("correlation_coefficient_points:          %lf\n", correlation_coefficient_points(points, point_length));
+
+	record records[] =
+	{
+		{ 0, 10, 1 }, { 1, 12, 2 }, { 2, 11, 1 }, { 3, 15, 3 }, { 4, 14, 2 },
+		{ 5, 18, 1 }, { 6, 17, 3 }, { 7, 21, 2 }, { 8, 20, 1 }, { 9, 24, 3 },
+	};
+	int record_length = sizeof(records) / sizeof(records[0]);
+
+	printf("\ncovariance_strided_general:              %lf\n", covariance_strided_general(&records[0].timestamp, 3, 0, 1, record_length));
+	printf("covariance_records:                      %lf\n", covariance_records(records, record_length));
+	printf("correlation_coefficient_strided_general: %lf\n", correlation_coefficient_strided_general(&records[0].timestamp, 3, 0, 1, record_length));
+	printf("correlation_coefficient_records:         %lf\n", correlation_coefficient_records(records, record_length));
+	printf("correlation_coefficient_strided(value, tag): %lf\n", correlation_coefficient_strided(&records[0].timestamp, 3, 1, 2, record_length));
+
+	// 傫ȔzőxrB
+	int large_length = 1 << 22;
+	record* large_records = (record*)malloc(sizeof(record) * large_length);
+
+	if (large_records == NULL)
+	{
+		return 1;
+	}
+
+	for (int i = 0; i < large_length; i++)
+	{
+		large_records[i].timestamp = i;
+		large_records[i].value = rand() % 16;
+		large_records[i].tag = large_records[i].value + rand() % 4;
+	}
+
+	clock_t start = clock();
+	double result = 0.0;
+
+	for (int repeat = 0; repeat < 10; repeat++)
+	{
+		result += correlation_coefficient_strided_general(&large_records[0].timestamp, 3, 1, 2, large_length);
+	}
+
+	printf("\ncorrelation_coefficient_strided_general: %lf (%ld ms)\n", result / 10, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	result = 0.0;
+
+	for (int repeat = 0; repeat < 10; repeat++)
+	{
+		result += correlation_coefficient_strided(&large_records[0].timestamp, 3, 1, 2, large_length);
+	}
+
+	printf("correlation_coefficient_strided:         %lf (%ld ms)\n", result / 10, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	free(large_records);
+
+	return 0;
+}
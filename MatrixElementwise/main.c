@@ -0,0 +1,500 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdio.h>
+#include <stddef.h>
+#include <intrin.h>
+
+// sA܂͂̈ꕔw\́B
+// stride ͍s̐擪m̊ԊuivfjŁAsł͌̍s̗񐔂ɂȂB
+typedef struct
+{
+	int* data;
+	int row;
+	int column;
+	int stride;
+} matrix_view;
+
+// float ^̗vfsA܂͂̈ꕔw\́B
+typedef struct
+{
+	float* data;
+	int row;
+	int column;
+	int stride;
+} matrix_view_float;
+
+// Asw matrix_view ֐B
+matrix_view make_matrix_view(int* data, int row, int column)
+{
+	matrix_view view = { data, row, column, column };
+	return view;
+}
+
+// s a  top s left 񂩂n܂Arow s column ̕sw matrix_view ֐B
+// vf̓Rs[ȂB
+matrix_view sub_matrix_view(matrix_view a, int top, int left, int row, int column)
+{
+	matrix_view view = { &a.data[(ptrdiff_t)top * a.stride + left], row, column, a.stride };
+	return view;
+}
+
+// s a  r sڂ̐擪w|C^[߂֐B
+int* matrix_row(matrix_view a, int r)
+{
+	return &a.data[(ptrdiff_t)r * a.stride];
+}
+
+// 擪 count ̗vfLȃ}XN߂֐B
+// count  0  8 ܂ŁB
+__m256i tail_mask_epi32(int count)
+{
+	static const int mask_table[16] =
+	{
+		-1, -1, -1, -1, -1, -1, -1, -1,
+		0, 0, 0, 0, 0, 0, 0, 0
+	};
+
+	return _mm256_loadu_si256((__m256i*)(&mask_table[8 - count]));
+}
+
+// ėp߂gAs a ̃XJ[{ result ɏފ֐B
+void matrix_scale_general(matrix_view a, int scalar, matrix_view result)
+{
+	for (int r = 0; r < a.row; r++)
+	{
+		const int* a_row = matrix_row(a, r);
+		int* result_row = matrix_row(result, r);
+
+		for (int c = 0; c < a.column; c++)
+		{
+			result_row[c] = a_row[c] * scalar;
+		}
+	}
+}
+
+// SIMD ߂gAs a ̃XJ[{ result ɏފ֐B
+// result  a n΁ȀŌvZB
+void matrix_scale(matrix_view a, int scalar, matrix_view result)
+{
+	__m256i scalar256 = _mm256_set1_epi32(scalar);
+	__m256i mask256 = tail_mask_epi32(a.column % 8);
+
+	for (int r = 0; r < a.row; r++)
+	{
+		const int* a_row = matrix_row(a, r);
+		int* result_row = matrix_row(result, r);
+		int c = 0;
+
+		// 8 vfvZB
+		for (; c + 7 < a.column; c += 8)
+		{
+			__m256i a256 = _mm256_loadu_si256((__m256i*)(&a_row[c]));
+			__m256i product256 = _mm256_mullo_epi32(a256, scalar256);
+			_mm256_storeu_si256((__m256i*)(&result_row[c]), product256);
+		}
+
+		// c̗vfB
+		// }XNgAs̖zēǂݏȂ悤ɂB
+		if (c < a.column)
+		{
+			__m256i a256 = _mm256_maskload_epi32(&a_row[c], mask256);
+			__m256i product256 = _mm256_mullo_epi32(a256, scalar256);
+			_mm256_maskstore_epi32(&result_row[c], mask256, product256);
+		}
+	}
+}
+
+// ėp߂gAs a  b ̘a result ɏފ֐B
+void matrix_add_general(matrix_view a, matrix_view b, matrix_view result)
+{
+	for (int r = 0; r < a.row; r++)
+	{
+		const int* a_row = matrix_row(a, r);
+		const int* b_row = matrix_row(b, r);
+		int* result_row = matrix_row(result, r);
+
+		for (int c = 0; c < a.column; c++)
+		{
+			result_row[c] = a_row[c] + b_row[c];
+		}
+	}
+}
+
+// SIMD ߂gAs a  b ̘a result ɏފ֐B
+void matrix_add(matrix_view a, matrix_view b, matrix_view result)
+{
+	__m256i mask256 = tail_mask_epi32(a.column % 8);
+
+	for (int r = 0; r < a.row; r++)
+	{
+		const int* a_row = matrix_row(a, r);
+		const int* b_row = matrix_row(b, r);
+		int* result_row = matrix_row(result, r);
+		int c = 0;
+
+		// 8 vfvZB
+		for (; c + 7 < a.column; c += 8)
+		{
+			__m256i a256 = _mm256_loadu_si256((__m256i*)(&a_row[c]));
+			__m256i b256 = _mm256_loadu_si256((__m256i*)(&b_row[c]));
+			_mm256_storeu_si256((__m256i*)(&result_row[c]), _mm256_add_epi32(a256, b256));
+		}
+
+		// c̗vf}XNtŏB
+		if (c < a.column)
+		{
+			__m256i a256 = _mm256_maskload_epi32(&a_row[c], mask256);
+			__m256i b256 = _mm256_maskload_epi32(&b_row[c], mask256);
+			_mm256_maskstore_epi32(&result_row[c], mask256, _mm256_add_epi32(a256, b256));
+		}
+	}
+}
+
+// ėp߂gAs a  b ̍ result ɏފ֐B
+void matrix_subtract_general(matrix_view a, matrix_view b, matrix_view result)
+{
+	for (int r = 0; r < a.row; r++)
+	{
+		const int* a_row = matrix_row(a, r);
+		const int* b_row = matrix_row(b, r);
+		int* result_row = matrix_row(result, r);
+
+		for (int c = 0; c < a.column; c++)
+		{
+			result_row[c] = a_row[c] - b_row[c];
+		}
+	}
+}
+
+// SIMD ߂gAs a  b ̍ result ɏފ֐B
+void matrix_subtract(matrix_view a, matrix_view b, matrix_view result)
+{
+	__m256i mask256 = tail_mask_epi32(a.column % 8);
+
+	for (int r = 0; r < a.row; r++)
+	{
+		const int* a_row = matrix_row(a, r);
+		const int* b_row = matrix_row(b, r);
+		int* result_row = matrix_row(result, r);
+		int c = 0;
+
+		// 8 vfvZB
+		for (; c + 7 < a.column; c += 8)
+		{
+			__m256i a256 = _mm256_loadu_si256((__m256i*)(&a_row[c]));
+			__m256i b256 = _mm256_loadu_si256((__m256i*)(&b_row[c]));
+			_mm256_storeu_si256((__m256i*)(&result_row[c]), _mm256_sub_epi32(a256, b256));
+		}
+
+		// c̗vf}XNtŏB
+		if (c < a.column)
+		{
+			__m256i a256 = _mm256_maskload_epi32(&a_row[c], mask256);
+			__m256i b256 = _mm256_maskload_epi32(&b_row[c], mask256);
+			_mm256_maskstore_epi32(&result_row[c], mask256, _mm256_sub_epi32(a256, b256));
+		}
+	}
+}
+
+// ėp߂gAs a  b ̗vfƂ̐ρiA_}[ρj result ɏފ֐B
+void matrix_multiply_elementwise_general(matrix_view a, matrix_view b, matrix_view result)
+{
+	for (int r = 0; r < a.row; r++)
+	{
+		const int* a_row = matrix_row(a, r);
+		const int* b_row = matrix_row(b, r);
+		int* result_row = matrix_row(result, r);
+
+		for (int c = 0; c < a.column; c++)
+		{
+			result_row[c] = a_row[c] * b_row[c];
+		}
+	}
+}
+
+// SIMD ߂gAs a  b ̗vfƂ̐ρiA_}[ρj result ɏފ֐B
+void matrix_multiply_elementwise(matrix_view a, matrix_view b, matrix_view result)
+{
+	__m256i mask256 = tail_mask_epi32(a.column % 8);
+
+	for (int r = 0; r < a.row; r++)
+	{
+		const int* a_row = matrix_row(a, r);
+		const int* b_row = matrix_row(b, r);
+		int* result_row = matrix_row(result, r);
+		int c = 0;
+
+		// 8 vfvZB
+		for (; c + 7 < a.column; c += 8)
+		{
+			__m256i a256 = _mm256_loadu_si256((__m256i*)(&a_row[c]));
+			__m256i b256 = _mm256_loadu_si256((__m256i*)(&b_row[c]));
+			_mm256_storeu_si256((__m256i*)(&result_row[c]), _mm256_mullo_epi32(a256, b256));
+		}
+
+		// c̗vf}XNtŏB
+		if (c < a.column)
+		{
+			__m256i a256 = _mm256_maskload_epi32(&a_row[c], mask256);
+			__m256i b256 = _mm256_maskload_epi32(&b_row[c], mask256);
+			_mm256_maskstore_epi32(&result_row[c], mask256, _mm256_mullo_epi32(a256, b256));
+		}
+	}
+}
+
+// ėp߂gAy = alpha * x + y vZ֐B
+void matrix_axpy_general(int alpha, matrix_view x, matrix_view y)
+{
+	for (int r = 0; r < x.row; r++)
+	{
+		const int* x_row = matrix_row(x, r);
+		int* y_row = matrix_row(y, r);
+
+		for (int c = 0; c < x.column; c++)
+		{
+			y_row[c] += alpha * x_row[c];
+		}
+	}
+}
+
+// SIMD ߂gAy = alpha * x + y vZ֐B
+void matrix_axpy(int alpha, matrix_view x, matrix_view y)
+{
+	__m256i alpha256 = _mm256_set1_epi32(alpha);
+	__m256i mask256 = tail_mask_epi32(x.column % 8);
+
+	for (int r = 0; r < x.row; r++)
+	{
+		const int* x_row = matrix_row(x, r);
+		int* y_row = matrix_row(y, r);
+		int c = 0;
+
+		// 8 vfvZB
+		for (; c + 7 < x.column; c += 8)
+		{
+			__m256i x256 = _mm256_loadu_si256((__m256i*)(&x_row[c]));
+			__m256i y256 = _mm256_loadu_si256((__m256i*)(&y_row[c]));
+			y256 = _mm256_add_epi32(y256, _mm256_mullo_epi32(alpha256, x256));
+			_mm256_storeu_si256((__m256i*)(&y_row[c]), y256);
+		}
+
+		// c̗vf}XNtŏB
+		if (c < x.column)
+		{
+			__m256i x256 = _mm256_maskload_epi32(&x_row[c], mask256);
+			__m256i y256 = _mm256_maskload_epi32(&y_row[c], mask256);
+			y256 = _mm256_add_epi32(y256, _mm256_mullo_epi32(alpha256, x256));
+			_mm256_maskstore_epi32(&y_row[c], mask256, y256);
+		}
+	}
+}
+
+// ėp߂gAs a ̊evf low ȏ high ȉɎ߂ result ɏފ֐B
+void matrix_clamp_general(matrix_view a, int low, int high, matrix_view result)
+{
+	for (int r = 0; r < a.row; r++)
+	{
+		const int* a_row = matrix_row(a, r);
+		int* result_row = matrix_row(result, r);
+
+		for (int c = 0; c < a.column; c++)
+		{
+			int value = a_row[c];
+
+			if (value < low)
+			{
+				value = low;
+			}
+
+			if (value > high)
+			{
+				value = high;
+			}
+
+			result_row[c] = value;
+		}
+	}
+}
+
+// SIMD ߂gAs a ̊evf low ȏ high ȉɎ߂ result ɏފ֐B
+void matrix_clamp(matrix_view a, int low, int high, matrix_view result)
+{
+	__m256i low256 = _mm256_set1_epi32(low);
+	__m256i high256 = _mm256_set1_epi32(high);
+	__m256i mask256 = tail_mask_epi32(a.column % 8);
+
+	for (int r = 0; r < a.row; r++)
+	{
+		const int* a_row = matrix_row(a, r);
+		int* result_row = matrix_row(result, r);
+		int c = 0;
+
+		// 8 vfvZB
+		for (; c + 7 < a.column; c += 8)
+		{
+			__m256i a256 = _mm256_loadu_si256((__m256i*)(&a_row[c]));
+			__m256i clamped256 = _mm256_min_epi32(_mm256_max_epi32(a256, low256), high256);
+			_mm256_storeu_si256((__m256i*)(&result_row[c]), clamped256);
+		}
+
+		// c̗vf}XNtŏB
+		if (c < a.column)
+		{
+			__m256i a256 = _mm256_maskload_epi32(&a_row[c], mask256);
+			__m256i clamped256 = _mm256_min_epi32(_mm256_max_epi32(a256, low256), high256);
+			_mm256_maskstore_epi32(&result_row[c], mask256, clamped256);
+		}
+	}
+}
+
+// ėp߂gAs a ̊evf float ^ɕϊ result ɏފ֐B
+void matrix_convert_to_float_general(matrix_view a, matrix_view_float result)
+{
+	for (int r = 0; r < a.row; r++)
+	{
+		const int* a_row = matrix_row(a, r);
+		float* result_row = &result.data[(ptrdiff_t)r * result.stride];
+
+		for (int c = 0; c < a.column; c++)
+		{
+			result_row[c] = (float)a_row[c];
+		}
+	}
+}
+
+// SIMD ߂gAs a ̊evf float ^ɕϊ result ɏފ֐B
+void matrix_convert_to_float(matrix_view a, matrix_view_float result)
+{
+	__m256i mask256 = tail_mask_epi32(a.column % 8);
+
+	for (int r = 0; r < a.row; r++)
+	{
+		const int* a_row = matrix_row(a, r);
+		float* result_row = &result.data[(ptrdiff_t)r * result.stride];
+		int c = 0;
+
+		// 8 vfϊB
+		for (; c + 7 < a.column; c += 8)
+		{
+			__m256i a256 = _mm256_loadu_si256((__m256i*)(&a_row[c]));
+			_mm256_storeu_ps(&result_row[c], _mm256_cvtepi32_ps(a256));
+		}
+
+		// c̗vf}XNtŏB
+		if (c < a.column)
+		{
+			__m256i a256 = _mm256_maskload_epi32(&a_row[c], mask256);
+			_mm256_maskstore_ps(&result_row[c], mask256, _mm256_cvtepi32_ps(a256));
+		}
+	}
+}
+
+void print_matrix(const char* name, matrix_view a)
+{
+	printf("%s:\n", name);
+
+	for (int r = 0; r < a.row; r++)
+	{
+		const int* a_row = matrix_row(a, r);
+
+		for (int c = 0; c < a.column; c++)
+		{
+			printf("%5d", a_row[c]);
+		}
+		printf("\n");
+	}
+}
+
+void print_matrix_float(const char* name, matrix_view_float a)
+{
+	printf("%s:\n", name);
+
+	for (int r = 0; r < a.row; r++)
+	{
+		const float* a_row = &a.data[(ptrdiff_t)r * a.stride];
+
+		for (int c = 0; c < a.column; c++)
+		{
+			printf("%5.1f", a_row[c]);
+		}
+		printf("\n");
+	}
+}
+
+#define ROW 4
+#define COLUMN 11
+
+int main(void)
+{
+	int a[ROW][COLUMN] =
+	{
+		{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 },
+		{ 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22 },
+		{ 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33 },
+		{ 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44 }
+	};
+	int b[ROW][COLUMN] =
+	{
+		{ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 },
+		{ 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2 },
+		{ 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3 },
+		{ 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4 }
+	};
+	int result[ROW][COLUMN] = { 0 };
+	int result_general[ROW][COLUMN] = { 0 };
+	float result_float[ROW][COLUMN] = { 0 };
+	float result_float_general[ROW][COLUMN] = { 0 };
+
+	matrix_view a_view = make_matrix_view((int*)a, ROW, COLUMN);
+	matrix_view b_view = make_matrix_view((int*)b, ROW, COLUMN);
+	matrix_view result_view = make_matrix_view((int*)result, ROW, COLUMN);
+	matrix_view result_general_view = make_matrix_view((int*)result_general, ROW, COLUMN);
+
+	// 1 s 1 ڂn܂ 3 s 9 ̕sB
+	// Rs[ɁA̍s̒𒼐ڌvZB
+	matrix_view a_sub = sub_matrix_view(a_view, 1, 1, 3, 9);
+	matrix_view b_sub = sub_matrix_view(b_view, 0, 0, 3, 9);
+	matrix_view result_sub = sub_matrix_view(result_view, 1, 1, 3, 9);
+	matrix_view result_general_sub = sub_matrix_view(result_general_view, 1, 1, 3, 9);
+
+	matrix_scale_general(a_view, 3, result_general_view);
+	print_matrix("matrix_scale_general", result_general_view);
+	matrix_scale(a_view, 3, result_view);
+	print_matrix("matrix_scale", result_view);
+
+	matrix_add_general(a_sub, b_sub, result_general_sub);
+	print_matrix("\nmatrix_add_general (sub matrix)", result_general_view);
+	matrix_add(a_sub, b_sub, result_sub);
+	print_matrix("matrix_add (sub matrix)", result_view);
+
+	matrix_subtract_general(a_view, b_view, result_general_view);
+	print_matrix("\nmatrix_subtract_general", result_general_view);
+	matrix_subtract(a_view, b_view, result_view);
+	print_matrix("matrix_subtract", result_view);
+
+	matrix_multiply_elementwise_general(a_view, b_view, result_general_view);
+	print_matrix("\nmatrix_multiply_elementwise_general", result_general_view);
+	matrix_multiply_elementwise(a_view, b_view, result_view);
+	print_matrix("matrix_multiply_elementwise", result_view);
+
+	matrix_axpy_general(2, a_sub, result_general_sub);
+	print_matrix("\nmatrix_axpy_general (sub matrix)", result_general_view);
+	matrix_axpy(2, a_sub, result_sub);
+	print_matrix("matrix_axpy (sub matrix)", result_view);
+
+	matrix_clamp_general(a_view, 10, 30, result_general_view);
+	print_matrix("\nmatrix_clamp_general", result_general_view);
+	matrix_clamp(a_view, 10, 30, result_view);
+	print_matrix("matrix_clamp", result_view);
+
+	matrix_view_float result_float_view = { (float*)result_float, ROW, COLUMN, COLUMN };
+	matrix_view_float result_float_general_view = { (float*)result_float_general, ROW, COLUMN, COLUMN };
+
+	matrix_convert_to_float_general(a_view, result_float_general_view);
+	print_matrix_float("\nmatrix_convert_to_float_general", result_float_general_view);
+	matrix_convert_to_float(a_view, result_float_view);
+	print_matrix_float("matrix_convert_to_float", result_float_view);
+
+	return 0;
+}
@@ -0,0 +1,897 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <intrin.h>
+
+// }CNJ[lxɌvZ C ̍sƗ񐔁B
+// 6 x 16 ̌ʂ 12 { YMM WX^[ɕێB
+#define MR 6
+#define NR 16
+
+// LbVubLȎ傫B
+// A ̃ubNiMC x KCj L2 LbVɁAB ̃pliKC x NRj L1 LbVɎ܂悤ɂB
+// B ̃ubNiKC x NCj L3 LbVɎ܂悤ɂB
+#define MC 72
+#define KC 256
+#define NC 4096
+
+// ̉񐔈ȏ̐ϘaZsꍇɁA}`XbhŌvZB
+#define PARALLEL_THRESHOLD (1 << 21)
+
+// ėp߂gAs̐ C = A * B ߂֐B
+// A  m s k AB  k s n AC  m s n B
+void matrix_multiply_general_ps(const float* a, const float* b, float* c, int m, int n, int k)
+{
+	for (int i = 0; i < m; i++)
+	{
+		for (int j = 0; j < n; j++)
+		{
+			c[i * n + j] = 0.0f;
+		}
+
+		for (int p = 0; p < k; p++)
+		{
+			float a_ip = a[i * k + p];
+
+			for (int j = 0; j < n; j++)
+			{
+				c[i * n + j] += a_ip * b[p * n + j];
+			}
+		}
+	}
+}
+
+// A  mc s kc ̃ubNAMR s̃plɋlߑւ֐B
+// pl̒ł́A MR ̗vfA悤ɕׂB
+// s MR ɖȂpl 0 Ŗ߂B
+void pack_a_ps(const float* a, int lda, int mc, int kc, float* packed)
+{
+	for (int i = 0; i < mc; i += MR)
+	{
+		int rows = mc - i < MR ? mc - i : MR;
+
+		for (int p = 0; p < kc; p++)
+		{
+			for (int r = 0; r < MR; r++)
+			{
+				*packed++ = r < rows ? a[(i + r) * lda + p] : 0.0f;
+			}
+		}
+	}
+}
+
+// B  kc s nc ̃ubNANR 񂸂̃plɋlߑւ֐B
+// pl̒ł́As NR ̗vfA悤ɕׂB
+// 񐔂 NR ɖȂpl 0 Ŗ߂B
+void pack_b_ps(const float* b, int ldb, int kc, int nc, float* packed)
+{
+	for (int j = 0; j < nc; j += NR)
+	{
+		int columns = nc - j < NR ? nc - j : NR;
+
+		for (int p = 0; p < kc; p++)
+		{
+			const float* b_row = &b[p * ldb + j];
+
+			if (columns == NR)
+			{
+				_mm256_storeu_ps(&packed[0], _mm256_loadu_ps(&b_row[0]));
+				_mm256_storeu_ps(&packed[8], _mm256_loadu_ps(&b_row[8]));
+			}
+			else
+			{
+				for (int c = 0; c < NR; c++)
+				{
+					packed[c] = c < columns ? b_row[c] : 0.0f;
+				}
+			}
+
+			packed += NR;
+		}
+	}
+}
+
+// lߑւ A ̃pl B ̃pl̐ςAC  rows s columns ɉZ֐B
+void micro_kernel_ps(int kc, const float* packed_a, const float* packed_b, float* c, int ldc, int rows, int columns)
+{
+	__m256 c00 = _mm256_setzero_ps(), c01 = _mm256_setzero_ps();
+	__m256 c10 = _mm256_setzero_ps(), c11 = _mm256_setzero_ps();
+	__m256 c20 = _mm256_setzero_ps(), c21 = _mm256_setzero_ps();
+	__m256 c30 = _mm256_setzero_ps(), c31 = _mm256_setzero_ps();
+	__m256 c40 = _mm256_setzero_ps(), c41 = _mm256_setzero_ps();
+	__m256 c50 = _mm256_setzero_ps(), c51 = _mm256_setzero_ps();
+
+	for (int p = 0; p < kc; p++)
+	{
+		__m256 b0 = _mm256_loadu_ps(&packed_b[0]);
+		__m256 b1 = _mm256_loadu_ps(&packed_b[8]);
+		__m256 a256;
+
+		a256 = _mm256_broadcast_ss(&packed_a[0]);
+		c00 = _mm256_fmadd_ps(a256, b0, c00);
+		c01 = _mm256_fmadd_ps(a256, b1, c01);
+
+		a256 = _mm256_broadcast_ss(&packed_a[1]);
+		c10 = _mm256_fmadd_ps(a256, b0, c10);
+		c11 = _mm256_fmadd_ps(a256, b1, c11);
+
+		a256 = _mm256_broadcast_ss(&packed_a[2]);
+		c20 = _mm256_fmadd_ps(a256, b0, c20);
+		c21 = _mm256_fmadd_ps(a256, b1, c21);
+
+		a256 = _mm256_broadcast_ss(&packed_a[3]);
+		c30 = _mm256_fmadd_ps(a256, b0, c30);
+		c31 = _mm256_fmadd_ps(a256, b1, c31);
+
+		a256 = _mm256_broadcast_ss(&packed_a[4]);
+		c40 = _mm256_fmadd_ps(a256, b0, c40);
+		c41 = _mm256_fmadd_ps(a256, b1, c41);
+
+		a256 = _mm256_broadcast_ss(&packed_a[5]);
+		c50 = _mm256_fmadd_ps(a256, b0, c50);
+		c51 = _mm256_fmadd_ps(a256, b1, c51);
+
+		packed_a += MR;
+		packed_b += NR;
+	}
+
+	// UWX^[̓eoAC ̗LȔ͈͂ɂZB
+	float result[MR][NR];
+	_mm256_storeu_ps(&result[0][0], c00);
+	_mm256_storeu_ps(&result[0][8], c01);
+	_mm256_storeu_ps(&result[1][0], c10);
+	_mm256_storeu_ps(&result[1][8], c11);
+	_mm256_storeu_ps(&result[2][0], c20);
+	_mm256_storeu_ps(&result[2][8], c21);
+	_mm256_storeu_ps(&result[3][0], c30);
+	_mm256_storeu_ps(&result[3][8], c31);
+	_mm256_storeu_ps(&result[4][0], c40);
+	_mm256_storeu_ps(&result[4][8], c41);
+	_mm256_storeu_ps(&result[5][0], c50);
+	_mm256_storeu_ps(&result[5][8], c51);
+
+	for (int r = 0; r < rows; r++)
+	{
+		float* c_row = &c[r * ldc];
+
+		if (columns == NR)
+		{
+			_mm256_storeu_ps(&c_row[0], _mm256_add_ps(_mm256_loadu_ps(&c_row[0]), _mm256_loadu_ps(&result[r][0])));
+			_mm256_storeu_ps(&c_row[8], _mm256_add_ps(_mm256_loadu_ps(&c_row[8]), _mm256_loadu_ps(&result[r][8])));
+		}
+		else
+		{
+			for (int j = 0; j < columns; j++)
+			{
+				c_row[j] += result[r][j];
+			}
+		}
+	}
+}
+
+// SIMD ߂gAs̐ C = A * B ߂֐B
+// A  m s k AB  k s n AC  m s n B
+void matrix_multiply_ps(const float* a, const float* b, float* c, int m, int n, int k)
+{
+	int parallel = (double)m * n * k >= PARALLEL_THRESHOLD;
+
+	// A ̃pbŃAs̃ubNƂɕʁẌ̗gB
+	// ̈ɓOɑSĊmۂĂ̂ŁAmۂɎsXbh΂Ƃ͂ȂB
+	int kc_max = k < KC ? k : KC;
+	int block_count = (m + MC - 1) / MC;
+	float* packed_b = (float*)_mm_malloc(sizeof(float) * KC * (NC + NR), 32);
+	float* packed_a = (float*)_mm_malloc(sizeof(float) * (MC + MR) * kc_max * block_count, 32);
+
+	// Ɨ̈mۂłȂꍇ́AubLOȂėp߂̔łŋ߂B
+	if (packed_a == NULL || packed_b == NULL)
+	{
+		_mm_free(packed_a);
+		_mm_free(packed_b);
+		matrix_multiply_general_ps(a, b, c, m, n, k);
+		return;
+	}
+
+	memset(c, 0, sizeof(float) * m * n);
+
+	for (int jc = 0; jc < n; jc += NC)
+	{
+		int nc = n - jc < NC ? n - jc : NC;
+
+		for (int pc = 0; pc < k; pc += KC)
+		{
+			int kc = k - pc < KC ? k - pc : KC;
+
+			// B ̃ubN͑SXbhŋLB
+			pack_b_ps(&b[pc * n + jc], n, kc, nc, packed_b);
+
+			// C ̍s̃ubNƂɃXbh𕪂B
+			// eXbh͕ʁX C ̗̈ɏނ̂ŁAȂB
+			#pragma omp parallel for schedule(dynamic) if(parallel)
+			for (int ic = 0; ic < m; ic += MC)
+			{
+				int mc = m - ic < MC ? m - ic : MC;
+
+				float* packed_a_block = &packed_a[(ic / MC) * (MC + MR) * kc_max];
+				pack_a_ps(&a[ic * k + pc], k, mc, kc, packed_a_block);
+
+				for (int jr = 0; jr < nc; jr += NR)
+				{
+					for (int ir = 0; ir < mc; ir += MR)
+					{
+						micro_kernel_ps(
+							kc,
+							&packed_a_block[ir * kc],
+							&packed_b[jr * kc],
+							&c[(ic + ir) * n + jc + jr],
+							n,
+							mc - ir < MR ? mc - ir : MR,
+							nc - jr < NR ? nc - jr : NR);
+					}
+				}
+			}
+		}
+	}
+
+	_mm_free(packed_a);
+	_mm_free(packed_b);
+}
+
+// ėp߂gAs̐ C = A * B ߂֐B
+// A  m s k AB  k s n AC  m s n B
+void matrix_multiply_general_epi32(const int* a, const int* b, int* c, int m, int n, int k)
+{
+	for (int i = 0; i < m; i++)
+	{
+		for (int j = 0; j < n; j++)
+		{
+			c[i * n + j] = 0;
+		}
+
+		for (int p = 0; p < k; p++)
+		{
+			int a_ip = a[i * k + p];
+
+			for (int j = 0; j < n; j++)
+			{
+				c[i * n + j] += a_ip * b[p * n + j];
+			}
+		}
+	}
+}
+
+// A  mc s kc ̃ubNAMR s̃plɋlߑւ֐B
+void pack_a_epi32(const int* a, int lda, int mc, int kc, int* packed)
+{
+	for (int i = 0; i < mc; i += MR)
+	{
+		int rows = mc - i < MR ? mc - i : MR;
+
+		for (int p = 0; p < kc; p++)
+		{
+			for (int r = 0; r < MR; r++)
+			{
+				*packed++ = r < rows ? a[(i + r) * lda + p] : 0;
+			}
+		}
+	}
+}
+
+// B  kc s nc ̃ubNANR 񂸂̃plɋlߑւ֐B
+void pack_b_epi32(const int* b, int ldb, int kc, int nc, int* packed)
+{
+	for (int j = 0; j < nc; j += NR)
+	{
+		int columns = nc - j < NR ? nc - j : NR;
+
+		for (int p = 0; p < kc; p++)
+		{
+			const int* b_row = &b[p * ldb + j];
+
+			if (columns == NR)
+			{
+				_mm256_storeu_si256((__m256i*)(&packed[0]), _mm256_loadu_si256((__m256i*)(&b_row[0])));
+				_mm256_storeu_si256((__m256i*)(&packed[8]), _mm256_loadu_si256((__m256i*)(&b_row[8])));
+			}
+			else
+			{
+				for (int c = 0; c < NR; c++)
+				{
+					packed[c] = c < columns ? b_row[c] : 0;
+				}
+			}
+
+			packed += NR;
+		}
+	}
+}
+
+// lߑւ A ̃pl B ̃pl̐ςAC  rows s columns ɉZ֐B
+void micro_kernel_epi32(int kc, const int* packed_a, const int* packed_b, int* c, int ldc, int rows, int columns)
+{
+	__m256i c00 = _mm256_setzero_si256(), c01 = _mm256_setzero_si256();
+	__m256i c10 = _mm256_setzero_si256(), c11 = _mm256_setzero_si256();
+	__m256i c20 = _mm256_setzero_si256(), c21 = _mm256_setzero_si256();
+	__m256i c30 = _mm256_setzero_si256(), c31 = _mm256_setzero_si256();
+	__m256i c40 = _mm256_setzero_si256(), c41 = _mm256_setzero_si256();
+	__m256i c50 = _mm256_setzero_si256(), c51 = _mm256_setzero_si256();
+
+	for (int p = 0; p < kc; p++)
+	{
+		__m256i b0 = _mm256_loadu_si256((__m256i*)(&packed_b[0]));
+		__m256i b1 = _mm256_loadu_si256((__m256i*)(&packed_b[8]));
+		__m256i a256;
+
+		a256 = _mm256_set1_epi32(packed_a[0]);
+		c00 = _mm256_add_epi32(c00, _mm256_mullo_epi32(a256, b0));
+		c01 = _mm256_add_epi32(c01, _mm256_mullo_epi32(a256, b1));
+
+		a256 = _mm256_set1_epi32(packed_a[1]);
+		c10 = _mm256_add_epi32(c10, _mm256_mullo_epi32(a256, b0));
+		c11 = _mm256_add_epi32(c11, _mm256_mullo_epi32(a256, b1));
+
+		a256 = _mm256_set1_epi32(packed_a[2]);
+		c20 = _mm256_add_epi32(c20, _mm256_mullo_epi32(a256, b0));
+		c21 = _mm256_add_epi32(c21, _mm256_mullo_epi32(a256, b1));
+
+		a256 = _mm256_set1_epi32(packed_a[3]);
+		c30 = _mm256_add_epi32(c30, _mm256_mullo_epi32(a256, b0));
+		c31 = _mm256_add_epi32(c31, _mm256_mullo_epi32(a256, b1));
+
+		a256 = _mm256_set1_epi32(packed_a[4]);
+		c40 = _mm256_add_epi32(c40, _mm256_mullo_epi32(a256, b0));
+		c41 = _mm256_add_epi32(c41, _mm256_mullo_epi32(a256, b1));
+
+		a256 = _mm256_set1_epi32(packed_a[5]);
+		c50 = _mm256_add_epi32(c50, _mm256_mullo_epi32(a256, b0));
+		c51 = _mm256_add_epi32(c51, _mm256_mullo_epi32(a256, b1));
+
+		packed_a += MR;
+		packed_b += NR;
+	}
+
+	// UWX^[̓eoAC ̗LȔ͈͂ɂZB
+	int result[MR][NR];
+	_mm256_storeu_si256((__m256i*)(&result[0][0]), c00);
+	_mm256_storeu_si256((__m256i*)(&result[0][8]), c01);
+	_mm256_storeu_si256((__m256i*)(&result[1][0]), c10);
+	_mm256_storeu_si256((__m256i*)(&result[1][8]), c11);
+	_mm256_storeu_si256((__m256i*)(&result[2][0]), c20);
+	_mm256_storeu_si256((__m256i*)(&result[2][8]), c21);
+	_mm256_storeu_si256((__m256i*)(&result[3][0]), c30);
+	_mm256_storeu_si256((__m256i*)(&result[3][8]), c31);
+	_mm256_storeu_si256((__m256i*)(&result[4][0]), c40);
+	_mm256_storeu_si256((__m256i*)(&result[4][8]), c41);
+	_mm256_storeu_si256((__m256i*)(&result[5][0]), c50);
+	_mm256_storeu_si256((__m256i*)(&result[5][8]), c51);
+
+	for (int r = 0; r < rows; r++)
+	{
+		int* c_row = &c[r * ldc];
+
+		if (columns == NR)
+		{
+			__m256i c0 = _mm256_loadu_si256((__m256i*)(&c_row[0]));
+			__m256i c1 = _mm256_loadu_si256((__m256i*)(&c_row[8]));
+			c0 = _mm256_add_epi32(c0, _mm256_loadu_si256((__m256i*)(&result[r][0])));
+			c1 = _mm256_add_epi32(c1, _mm256_loadu_si256((__m256i*)(&result[r][8])));
+			_mm256_storeu_si256((__m256i*)(&c_row[0]), c0);
+			_mm256_storeu_si256((__m256i*)(&c_row[8]), c1);
+		}
+		else
+		{
+			for (int j = 0; j < columns; j++)
+			{
+				c_row[j] += result[r][j];
+			}
+		}
+	}
+}
+
+// SIMD ߂gAs̐ C = A * B ߂֐B
+// A  m s k AB  k s n AC  m s n B
+void matrix_multiply_epi32(const int* a, const int* b, int* c, int m, int n, int k)
+{
+	int parallel = (double)m * n * k >= PARALLEL_THRESHOLD;
+
+	// A ̃pbŃAs̃ubNƂɕʁẌ̗gB
+	// ̈ɓOɑSĊmۂĂ̂ŁAmۂɎsXbh΂Ƃ͂ȂB
+	int kc_max = k < KC ? k : KC;
+	int block_count = (m + MC - 1) / MC;
+	int* packed_b = (int*)_mm_malloc(sizeof(int) * KC * (NC + NR), 32);
+	int* packed_a = (int*)_mm_malloc(sizeof(int) * (MC + MR) * kc_max * block_count, 32);
+
+	// Ɨ̈mۂłȂꍇ́AubLOȂėp߂̔łŋ߂B
+	if (packed_a == NULL || packed_b == NULL)
+	{
+		_mm_free(packed_a);
+		_mm_free(packed_b);
+		matrix_multiply_general_epi32(a, b, c, m, n, k);
+		return;
+	}
+
+	memset(c, 0, sizeof(int) * m * n);
+
+	for (int jc = 0; jc < n; jc += NC)
+	{
+		int nc = n - jc < NC ? n - jc : NC;
+
+		for (int pc = 0; pc < k; pc += KC)
+		{
+			int kc = k - pc < KC ? k - pc : KC;
+
+			pack_b_epi32(&b[pc * n + jc], n, kc, nc, packed_b);
+
+			#pragma omp parallel for schedule(dynamic) if(parallel)
+			for (int ic = 0; ic < m; ic += MC)
+			{
+				int mc = m - ic < MC ? m - ic : MC;
+
+				int* packed_a_block = &packed_a[(ic / MC) * (MC + MR) * kc_max];
+				pack_a_epi32(&a[ic * k + pc], k, mc, kc, packed_a_block);
+
+				for (int jr = 0; jr < nc; jr += NR)
+				{
+					for (int ir = 0; ir < mc; ir += MR)
+					{
+						micro_kernel_epi32(
+							kc,
+							&packed_a_block[ir * kc],
+							&packed_b[jr * kc],
+							&c[(ic + ir) * n + jc + jr],
+							n,
+							mc - ir < MR ? mc - ir : MR,
+							nc - jr < NR ? nc - jr : NR);
+					}
+				}
+			}
+		}
+	}
+
+	_mm_free(packed_a);
+	_mm_free(packed_b);
+}
+
+// ėp߂gAsƃxNg̐ y = A * x ߂֐B
+// A  m s n Ax  n vfAy  m vfB
+void matrix_vector_multiply_general_ps(const float* a, const float* x, float* y, int m, int n)
+{
+	for (int i = 0; i < m; i++)
+	{
+		float sum = 0.0f;
+
+		for (int j = 0; j < n; j++)
+		{
+			sum += a[i * n + j] * x[j];
+		}
+
+		y[i] = sum;
+	}
+}
+
+// SIMD ߂gAsƃxNg̐ y = A * x ߂֐B
+// A  m s n Ax  n vfAy  m vfB
+void matrix_vector_multiply_ps(const float* a, const float* x, float* y, int m, int n)
+{
+	int parallel = (double)m * n >= PARALLEL_THRESHOLD;
+
+	// 4 sAǂݍ x  4 sŎg񂷁B
+	#pragma omp parallel for if(parallel)
+	for (int i = 0; i < m - 3; i += 4)
+	{
+		const float* a0 = &a[(i + 0) * n];
+		const float* a1 = &a[(i + 1) * n];
+		const float* a2 = &a[(i + 2) * n];
+		const float* a3 = &a[(i + 3) * n];
+
+		__m256 sum0 = _mm256_setzero_ps();
+		__m256 sum1 = _mm256_setzero_ps();
+		__m256 sum2 = _mm256_setzero_ps();
+		__m256 sum3 = _mm256_setzero_ps();
+
+		int j = 0;
+
+		for (; j + 7 < n; j += 8)
+		{
+			__m256 x256 = _mm256_loadu_ps(&x[j]);
+			sum0 = _mm256_fmadd_ps(_mm256_loadu_ps(&a0[j]), x256, sum0);
+			sum1 = _mm256_fmadd_ps(_mm256_loadu_ps(&a1[j]), x256, sum1);
+			sum2 = _mm256_fmadd_ps(_mm256_loadu_ps(&a2[j]), x256, sum2);
+			sum3 = _mm256_fmadd_ps(_mm256_loadu_ps(&a3[j]), x256, sum3);
+		}
+
+		// 4 s̍v 1 {̃xNgɂ܂Ƃ߂B
+		__m256 sum01 = _mm256_hadd_ps(sum0, sum1);
+		__m256 sum23 = _mm256_hadd_ps(sum2, sum3);
+		__m256 sum0123 = _mm256_hadd_ps(sum01, sum23);
+		__m128 result128 = _mm_add_ps(_mm256_castps256_ps128(sum0123), _mm256_extractf128_ps(sum0123, 1));
+
+		float result[4];
+		_mm_storeu_ps(result, result128);
+
+		// c̗vfB
+		// ͔ėp߁B
+		for (; j < n; j++)
+		{
+			result[0] += a0[j] * x[j];
+			result[1] += a1[j] * x[j];
+			result[2] += a2[j] * x[j];
+			result[3] += a3[j] * x[j];
+		}
+
+		y[i + 0] = result[0];
+		y[i + 1] = result[1];
+		y[i + 2] = result[2];
+		y[i + 3] = result[3];
+	}
+
+	// c̍sB
+	for (int i = m - m % 4; i < m; i++)
+	{
+		const float* a_row = &a[i * n];
+		__m256 sum256 = _mm256_setzero_ps();
+		int j = 0;
+
+		for (; j + 7 < n; j += 8)
+		{
+			sum256 = _mm256_fmadd_ps(_mm256_loadu_ps(&a_row[j]), _mm256_loadu_ps(&x[j]), sum256);
+		}
+
+		__m128 sum128 = _mm_add_ps(_mm256_castps256_ps128(sum256), _mm256_extractf128_ps(sum256, 1));
+		sum128 = _mm_hadd_ps(sum128, sum128);
+		sum128 = _mm_hadd_ps(sum128, sum128);
+		float sum = _mm_cvtss_f32(sum128);
+
+		for (; j < n; j++)
+		{
+			sum += a_row[j] * x[j];
+		}
+
+		y[i] = sum;
+	}
+}
+
+// ėp߂gAsƃxNg̐ y = A * x ߂֐B
+// A  m s n Ax  n vfAy  m vfB
+void matrix_vector_multiply_general_epi32(const int* a, const int* x, int* y, int m, int n)
+{
+	for (int i = 0; i < m; i++)
+	{
+		int sum = 0;
+
+		for (int j = 0; j < n; j++)
+		{
+			sum += a[i * n + j] * x[j];
+		}
+
+		y[i] = sum;
+	}
+}
+
+// SIMD ߂gAsƃxNg̐ y = A * x ߂֐B
+// A  m s n Ax  n vfAy  m vfB
+void matrix_vector_multiply_epi32(const int* a, const int* x, int* y, int m, int n)
+{
+	int parallel = (double)m * n >= PARALLEL_THRESHOLD;
+
+	// 4 sAǂݍ x  4 sŎg񂷁B
+	#pragma omp parallel for if(parallel)
+	for (int i = 0; i < m - 3; i += 4)
+	{
+		const int* a0 = &a[(i + 0) * n];
+		const int* a1 = &a[(i + 1) * n];
+		const int* a2 = &a[(i + 2) * n];
+		const int* a3 = &a[(i + 3) * n];
+
+		__m256i sum0 = _mm256_setzero_si256();
+		__m256i sum1 = _mm256_setzero_si256();
+		__m256i sum2 = _mm256_setzero_si256();
+		__m256i sum3 = _mm256_setzero_si256();
+
+		int j = 0;
+
+		for (; j + 7 < n; j += 8)
+		{
+			__m256i x256 = _mm256_loadu_si256((__m256i*)(&x[j]));
+			sum0 = _mm256_add_epi32(sum0, _mm256_mullo_epi32(_mm256_loadu_si256((__m256i*)(&a0[j])), x256));
+			sum1 = _mm256_add_epi32(sum1, _mm256_mullo_epi32(_mm256_loadu_si256((__m256i*)(&a1[j])), x256));
+			sum2 = _mm256_add_epi32(sum2, _mm256_mullo_epi32(_mm256_loadu_si256((__m256i*)(&a2[j])), x256));
+			sum3 = _mm256_add_epi32(sum3, _mm256_mullo_epi32(_mm256_loadu_si256((__m256i*)(&a3[j])), x256));
+		}
+
+		// 4 s̍v 1 {̃xNgɂ܂Ƃ߂B
+		__m256i sum01 = _mm256_hadd_epi32(sum0, sum1);
+		__m256i sum23 = _mm256_hadd_epi32(sum2, sum3);
+		__m256i sum0123 = _mm256_hadd_epi32(sum01, sum23);
+		__m128i result128 = _mm_add_epi32(_mm256_castsi256_si128(sum0123), _mm256_extracti128_si256(sum0123, 1));
+
+		int result[4];
+		_mm_storeu_si128((__m128i*)result, result128);
+
+		// c̗vfB
+		// ͔ėp߁B
+		for (; j < n; j++)
+		{
+			result[0] += a0[j] * x[j];
+			result[1] += a1[j] * x[j];
+			result[2] += a2[j] * x[j];
+			result[3] += a3[j] * x[j];
+		}
+
+		y[i + 0] = result[0];
+		y[i + 1] = result[1];
+		y[i + 2] = result[2];
+		y[i + 3] = result[3];
+	}
+
+	// c̍sB
+	for (int i = m - m % 4; i < m; i++)
+	{
+		const int* a_row = &a[i * n];
+		__m256i sum256 = _mm256_setzero_si256();
+		int j = 0;
+
+		for (; j + 7 < n; j += 8)
+		{
+			__m256i a256 = _mm256_loadu_si256((__m256i*)(&a_row[j]));
+			__m256i x256 = _mm256_loadu_si256((__m256i*)(&x[j]));
+			sum256 = _mm256_add_epi32(sum256, _mm256_mullo_epi32(a256, x256));
+		}
+
+		__m128i sum128 = _mm_add_epi32(_mm256_castsi256_si128(sum256), _mm256_extracti128_si256(sum256, 1));
+		sum128 = _mm_hadd_epi32(sum128, sum128);
+		sum128 = _mm_hadd_epi32(sum128, sum128);
+		int sum = _mm_cvtsi128_si32(sum128);
+
+		for (; j < n; j++)
+		{
+			sum += a_row[j] * x[j];
+		}
+
+		y[i] = sum;
+	}
+}
+
+// ̍s̐ςƁAsƃxNg̐ςėpłƔr֐B
+int check_epi32(int m, int n, int k)
+{
+	int* a = (int*)malloc(sizeof(int) * m * k);
+	int* b = (int*)malloc(sizeof(int) * k * n);
+	int* c = (int*)malloc(sizeof(int) * m * n);
+	int* c_general = (int*)malloc(sizeof(int) * m * n);
+
+	if (a == NULL || b == NULL || c == NULL || c_general == NULL)
+	{
+		free(a);
+		free(b);
+		free(c);
+		free(c_general);
+		return 0;
+	}
+
+	for (int i = 0; i < m * k; i++)
+	{
+		a[i] = i % 5 - 2;
+	}
+
+	for (int i = 0; i < k * n; i++)
+	{
+		b[i] = i % 7 - 3;
+	}
+
+	printf("%d x %d x %d\n", m, n, k);
+
+	matrix_multiply_general_epi32(a, b, c_general, m, n, k);
+	matrix_multiply_epi32(a, b, c, m, n, k);
+	printf("matrix_multiply_epi32:        %s\n", memcmp(c, c_general, sizeof(int) * m * n) == 0 ? "OK" : "NG");
+
+	matrix_vector_multiply_general_epi32(a, b, c_general, m, k);
+	matrix_vector_multiply_epi32(a, b, c, m, k);
+	printf("matrix_vector_multiply_epi32: %s\n", memcmp(c, c_general, sizeof(int) * m) == 0 ? "OK" : "NG");
+
+	free(a);
+	free(b);
+	free(c);
+	free(c_general);
+
+	return 1;
+}
+
+// _̍s̐ςƁAsƃxNg̐ςėpłƔr֐B
+// vf͏ȐȂ̂ŁAZ̏Ăʂ͈vB
+int check_ps(int m, int n, int k)
+{
+	float* a = (float*)malloc(sizeof(float) * m * k);
+	float* b = (float*)malloc(sizeof(float) * k * n);
+	float* c = (float*)malloc(sizeof(float) * m * n);
+	float* c_general = (float*)malloc(sizeof(float) * m * n);
+
+	if (a == NULL || b == NULL || c == NULL || c_general == NULL)
+	{
+		free(a);
+		free(b);
+		free(c);
+		free(c_general);
+		return 0;
+	}
+
+	for (int i = 0; i < m * k; i++)
+	{
+		a[i] = (float)(i % 5 - 2);
+	}
+
+	for (int i = 0; i < k * n; i++)
+	{
+		b[i] = (float)(i % 7 - 3);
+	}
+
+	matrix_multiply_general_ps(a, b, c_general, m, n, k);
+	matrix_multiply_ps(a, b, c, m, n, k);
+	printf("matrix_multiply_ps:           %s\n", memcmp(c, c_general, sizeof(float) * m * n) == 0 ? "OK" : "NG");
+
+	matrix_vector_multiply_general_ps(a, b, c_general, m, k);
+	matrix_vector_multiply_ps(a, b, c, m, k);
+	printf("matrix_vector_multiply_ps:    %s\n", memcmp(c, c_general, sizeof(float) * m) == 0 ? "OK" : "NG");
+
+	free(a);
+	free(b);
+	free(c);
+	free(c_general);
+
+	return 1;
+}
+
+int main(void)
+{
+	// [̏mF邽߁AMR  NR Ŋ؂Ȃ傫ɂB
+	// 2 ڂ MCAKCANC 𒴂傫ɂāAubLŐEmFB
+	if (!check_epi32(13, 19, 7) || !check_ps(13, 19, 7) || !check_epi32(MC * 2 + 5, NC + 21, KC + 37) || !check_ps(MC * 2 + 5, NC + 21, KC + 37))
+	{
+		return 1;
+	}
+
+	// 傫Ȑ̍sőxrB
+	int size = 1024;
+	int* a = (int*)malloc(sizeof(int) * size * size);
+	int* b = (int*)malloc(sizeof(int) * size * size);
+	int* c = (int*)malloc(sizeof(int) * size * size);
+	int* c_general = (int*)malloc(sizeof(int) * size * size);
+
+	if (a == NULL || b == NULL || c == NULL || c_general == NULL)
+	{
+		return 1;
+	}
+
+	for (int i = 0; i < size * size; i++)
+	{
+		a[i] = i % 5 - 2;
+		b[i] = i % 7 - 3;
+	}
+
+	double operations = 2.0 * size * size * size;
+
+	clock_t start = clock();
+	matrix_multiply_general_epi32(a, b, c_general, size, size, size);
+	double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("\nmatrix_multiply_general_epi32: %.3f s (%.1f GOPS)\n", seconds, operations / seconds / 1e9);
+
+	start = clock();
+	matrix_multiply_epi32(a, b, c, size, size, size);
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("matrix_multiply_epi32:         %.3f s (%.1f GOPS)\n", seconds, operations / seconds / 1e9);
+	printf("result:                        %s\n", memcmp(c, c_general, sizeof(int) * size * size) == 0 ? "OK" : "NG");
+
+	// sƃxNg̐ς͌vZʂȂ߁AJԂČvB
+	int repeat = 100;
+	operations = 2.0 * size * size * repeat;
+
+	start = clock();
+	for (int r = 0; r < repeat; r++)
+	{
+		matrix_vector_multiply_general_epi32(a, b, c_general, size, size);
+	}
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("\nmatrix_vector_multiply_general_epi32: %.3f s (%.1f GOPS)\n", seconds, operations / seconds / 1e9);
+
+	start = clock();
+	for (int r = 0; r < repeat; r++)
+	{
+		matrix_vector_multiply_epi32(a, b, c, size, size);
+	}
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("matrix_vector_multiply_epi32:         %.3f s (%.1f GOPS)\n", seconds, operations / seconds / 1e9);
+	printf("result:                               %s\n", memcmp(c, c_general, sizeof(int) * size) == 0 ? "OK" : "NG");
+
+	free(a);
+	free(b);
+	free(c);
+	free(c_general);
+
+	// 傫ȕ_̍sőxrB
+	float* a_ps = (float*)malloc(sizeof(float) * size * size);
+	float* b_ps = (float*)malloc(sizeof(float) * size * size);
+	float* c_ps = (float*)malloc(sizeof(float) * size * size);
+	float* c_general_ps = (float*)malloc(sizeof(float) * size * size);
+
+	if (a_ps == NULL || b_ps == NULL || c_ps == NULL || c_general_ps == NULL)
+	{
+		return 1;
+	}
+
+	for (int i = 0; i < size * size; i++)
+	{
+		a_ps[i] = (float)(i % 11) / 11.0f;
+		b_ps[i] = (float)(i % 13) / 13.0f;
+	}
+
+	operations = 2.0 * size * size * size;
+
+	start = clock();
+	matrix_multiply_general_ps(a_ps, b_ps, c_general_ps, size, size, size);
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("\nmatrix_multiply_general_ps: %.3f s (%.1f GFLOPS)\n", seconds, operations / seconds / 1e9);
+
+	start = clock();
+	matrix_multiply_ps(a_ps, b_ps, c_ps, size, size, size);
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("matrix_multiply_ps:         %.3f s (%.1f GFLOPS)\n", seconds, operations / seconds / 1e9);
+
+	// Z̏قȂ邽߁A덷eĔrB
+	float max_error = 0.0f;
+
+	for (int i = 0; i < size * size; i++)
+	{
+		float error = fabsf(c_ps[i] - c_general_ps[i]) / fabsf(c_general_ps[i]);
+
+		if (error > max_error)
+		{
+			max_error = error;
+		}
+	}
+
+	printf("max relative error:         %e\n", max_error);
+
+	// sƃxNg̐ς͌vZʂȂ߁AJԂČvB
+	operations = 2.0 * size * size * repeat;
+
+	start = clock();
+	for (int r = 0; r < repeat; r++)
+	{
+		matrix_vector_multiply_general_ps(a_ps, b_ps, c_general_ps, size, size);
+	}
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("\nmatrix_vector_multiply_general_ps: %.3f s (%.1f GFLOPS)\n", seconds, operations / seconds / 1e9);
+
+	start = clock();
+	for (int r = 0; r < repeat; r++)
+	{
+		matrix_vector_multiply_ps(a_ps, b_ps, c_ps, size, size);
+	}
+	seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	printf("matrix_vector_multiply_ps:         %.3f s (%.1f GFLOPS)\n", seconds, operations / seconds / 1e9);
+
+	max_error = 0.0f;
+
+	for (int i = 0; i < size; i++)
+	{
+		float error = fabsf(c_ps[i] - c_general_ps[i]) / fabsf(c_general_ps[i]);
+
+		if (error > max_error)
+		{
+			max_error = error;
+		}
+	}
+
+	printf("max relative error:                %e\n", max_error);
+
+	free(a_ps);
+	free(b_ps);
+	free(c_ps);
+	free(c_general_ps);
+
+	return 0;
+}
@@ -0,0 +1,601 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdio.h>
+#include <limits.h>
+#include <intrin.h>
+
+// r̎ށB
+typedef enum
+{
+	PREDICATE_EQUAL,
+	PREDICATE_NOT_EQUAL,
+	PREDICATE_LESS,
+	PREDICATE_LESS_EQUAL,
+	PREDICATE_GREATER,
+	PREDICATE_GREATER_EQUAL
+} predicate;
+
+// SĂ̔rulow ȏ high ȉvƂ̔ےŕ\B
+// r̎ނƂɕ򂹂ɁA[vőSĂ̔rłB
+typedef struct
+{
+	int low;
+	int high;
+	int invert;
+} predicate_range;
+
+// r op  key A͈͂̏ɕϊ֐B
+predicate_range make_predicate_range(predicate op, int key)
+{
+	predicate_range range = { INT_MIN, INT_MAX, 0 };
+
+	switch (op)
+	{
+	case PREDICATE_EQUAL:
+		range.low = key;
+		range.high = key;
+		break;
+	case PREDICATE_NOT_EQUAL:
+		range.low = key;
+		range.high = key;
+		range.invert = 1;
+		break;
+	case PREDICATE_LESS:
+		// INT_MIN 菬l͂Ȃ̂ŁAS͈͂̔ےiɋUjɂB
+		if (key == INT_MIN)
+		{
+			range.invert = 1;
+		}
+		else
+		{
+			range.high = key - 1;
+		}
+		break;
+	case PREDICATE_LESS_EQUAL:
+		range.high = key;
+		break;
+	case PREDICATE_GREATER:
+		if (key == INT_MAX)
+		{
+			range.invert = 1;
+		}
+		else
+		{
+			range.low = key + 1;
+		}
+		break;
+	case PREDICATE_GREATER_EQUAL:
+		range.low = key;
+		break;
+	}
+
+	return range;
+}
+
+// ėp߂gAvalue 𖞂ǂ𔻒肷֐B
+int test_range_general(predicate_range range, int value)
+{
+	return (range.low <= value && value <= range.high) != range.invert;
+}
+
+// SIMD ߂gA8 ̗vf𖞂ǂ𔻒肷֐B
+// 𖞂vf͑Srbg 1 ɂȂB
+// inside256 ́A͈͓̗vfIԂƂ͑Srbg 1A͈͊O̗vfIԂƂ 0 ɂB
+__m256i test_range_epi32(__m256i a256, __m256i low256, __m256i high256, __m256i inside256)
+{
+	__m256i outside256 = _mm256_or_si256(_mm256_cmpgt_epi32(low256, a256), _mm256_cmpgt_epi32(a256, high256));
+	return _mm256_xor_si256(outside256, inside256);
+}
+
+// rbg}bv 1 oCgi8 vfjAvfƂ̃}XNɍL֐B
+__m256i expand_bitmap_byte(unsigned char bits)
+{
+	__m256i lane_bits256 = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+	__m256i bits256 = _mm256_set1_epi32(bits);
+	return _mm256_cmpeq_epi32(_mm256_and_si256(bits256, lane_bits256), lane_bits256);
+}
+
+// ėp߂gAz a ̒ŏ𖞂vfrbg}bvɋL^֐B
+// bitmap  i / 8 oCgڂ i % 8 rbgڂAa[i] ɑΉB
+// 𖞂vf̐ԂB
+int filter_general(const int a[], int length, predicate op, int key, unsigned char bitmap[])
+{
+	predicate_range range = make_predicate_range(op, key);
+	int count = 0;
+
+	for (int i = 0; i < length; i += 8)
+	{
+		bitmap[i / 8] = 0;
+	}
+
+	for (int i = 0; i < length; i++)
+	{
+		if (test_range_general(range, a[i]))
+		{
+			bitmap[i / 8] |= (unsigned char)(1 << (i % 8));
+			count++;
+		}
+	}
+
+	return count;
+}
+
+// rbg}bvɋL^͈͂̏֐B
+int filter_range_bitmap(const int a[], int length, predicate_range range, unsigned char bitmap[])
+{
+	__m256i low256 = _mm256_set1_epi32(range.low);
+	__m256i high256 = _mm256_set1_epi32(range.high);
+	__m256i inside256 = _mm256_set1_epi32(range.invert ? 0 : -1);
+
+	int count = 0;
+	int i = 0;
+
+	// evf 8 A茋ʂ 1 oCgɂ܂Ƃ߂B
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i selected256 = test_range_epi32(a256, low256, high256, inside256);
+		int mask = _mm256_movemask_ps(_mm256_castsi256_ps(selected256));
+
+		bitmap[i / 8] = (unsigned char)mask;
+		count += __popcnt(mask);
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	if (i < length)
+	{
+		unsigned char bits = 0;
+
+		for (int j = i; j < length; j++)
+		{
+			if (test_range_general(range, a[j]))
+			{
+				bits |= (unsigned char)(1 << (j - i));
+				count++;
+			}
+		}
+
+		bitmap[i / 8] = bits;
+	}
+
+	return count;
+}
+
+// SIMD ߂gAz a ̒ a[i] op key 𖞂vfrbg}bvɋL^֐B
+// 𖞂vf̐ԂB
+int filter(const int a[], int length, predicate op, int key, unsigned char bitmap[])
+{
+	return filter_range_bitmap(a, length, make_predicate_range(op, key), bitmap);
+}
+
+// SIMD ߂gAz a ̒ low ȏ high ȉ̗vfrbg}bvɋL^֐B
+// 𖞂vf̐ԂB
+int filter_range(const int a[], int length, int low, int high, unsigned char bitmap[])
+{
+	predicate_range range = { low, high, 0 };
+	return filter_range_bitmap(a, length, range, bitmap);
+}
+
+// SIMD ߂gAz a ̒ set ̂ꂩƓvfrbg}bvɋL^֐B
+// 𖞂vf̐ԂB
+int filter_in_set(const int a[], int length, const int set[], int set_length, unsigned char bitmap[])
+{
+	int count = 0;
+	int i = 0;
+
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i selected256 = _mm256_setzero_si256();
+
+		// W̗vfƂɔrAʂ̘_aB
+		for (int s = 0; s < set_length; s++)
+		{
+			__m256i equals256 = _mm256_cmpeq_epi32(a256, _mm256_set1_epi32(set[s]));
+			selected256 = _mm256_or_si256(selected256, equals256);
+		}
+
+		int mask = _mm256_movemask_ps(_mm256_castsi256_ps(selected256));
+
+		bitmap[i / 8] = (unsigned char)mask;
+		count += __popcnt(mask);
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	if (i < length)
+	{
+		unsigned char bits = 0;
+
+		for (int j = i; j < length; j++)
+		{
+			for (int s = 0; s < set_length; s++)
+			{
+				if (a[j] == set[s])
+				{
+					bits |= (unsigned char)(1 << (j - i));
+					count++;
+					break;
+				}
+			}
+		}
+
+		bitmap[i / 8] = bits;
+	}
+
+	return count;
+}
+
+// rbg}bvőI΂ꂽvf̐߂֐B
+int count_selected(const unsigned char bitmap[], int length)
+{
+	int count = 0;
+	int i = 0;
+
+	for (; i + 7 < length; i += 8)
+	{
+		count += __popcnt(bitmap[i / 8]);
+	}
+
+	// Ō̃oCg length zrbgB
+	if (i < length)
+	{
+		count += __popcnt(bitmap[i / 8] & ((1u << (length - i)) - 1));
+	}
+
+	return count;
+}
+
+// SIMD ߂gArbg}bvőI΂ꂽz b ̗vf̘a߂֐B
+int sum_selected(const int b[], int length, const unsigned char bitmap[])
+{
+	int i = 0;
+	__m256i sum256 = _mm256_setzero_si256();
+
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i b256 = _mm256_loadu_si256((__m256i*)(&b[i]));
+		__m256i mask256 = expand_bitmap_byte(bitmap[i / 8]);
+
+		// I΂Ȃvf 0 ɂĂ瑫B
+		sum256 = _mm256_add_epi32(sum256, _mm256_and_si256(b256, mask256));
+	}
+
+	// vlXJ[lɕϊB
+	__m256i sum256_permute = _mm256_permute2x128_si256(sum256, sum256, 1);
+	__m256i result256 = _mm256_hadd_epi32(sum256, sum256_permute);
+	result256 = _mm256_hadd_epi32(result256, result256);
+	result256 = _mm256_hadd_epi32(result256, result256);
+	int sum = _mm256_extract_epi32(result256, 0);
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		if (bitmap[i / 8] & (1 << (i % 8)))
+		{
+			sum += b[i];
+		}
+	}
+
+	return sum;
+}
+
+// SIMD ߂gArbg}bvőI΂ꂽz b ̗vf̍ŏl߂֐B
+// 1 I΂ĂȂꍇ INT_MAX ԂB
+int min_of_selected(const int b[], int length, const unsigned char bitmap[])
+{
+	int i = 0;
+	__m256i max256 = _mm256_set1_epi32(INT_MAX);
+	__m256i min_value256 = max256;
+
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i b256 = _mm256_loadu_si256((__m256i*)(&b[i]));
+		__m256i mask256 = expand_bitmap_byte(bitmap[i / 8]);
+
+		// I΂Ȃvf INT_MAX ɒuB
+		__m256i selected256 = _mm256_blendv_epi8(max256, b256, mask256);
+		min_value256 = _mm256_min_epi32(min_value256, selected256);
+	}
+
+	// ŏlXJ[lɕϊB
+	int result[8];
+	_mm256_storeu_si256((__m256i*)result, min_value256);
+
+	int min_value = result[0];
+
+	for (int j = 1; j < 8; j++)
+	{
+		if (result[j] < min_value)
+		{
+			min_value = result[j];
+		}
+	}
+
+	// c̗vfB
+	for (; i < length; i++)
+	{
+		if ((bitmap[i / 8] & (1 << (i % 8))) && b[i] < min_value)
+		{
+			min_value = b[i];
+		}
+	}
+
+	return min_value;
+}
+
+// SIMD ߂gArbg}bvőI΂ꂽz b ̗vf̍ől߂֐B
+// 1 I΂ĂȂꍇ INT_MIN ԂB
+int max_of_selected(const int b[], int length, const unsigned char bitmap[])
+{
+	int i = 0;
+	__m256i min256 = _mm256_set1_epi32(INT_MIN);
+	__m256i max_value256 = min256;
+
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i b256 = _mm256_loadu_si256((__m256i*)(&b[i]));
+		__m256i mask256 = expand_bitmap_byte(bitmap[i / 8]);
+
+		// I΂Ȃvf INT_MIN ɒuB
+		__m256i selected256 = _mm256_blendv_epi8(min256, b256, mask256);
+		max_value256 = _mm256_max_epi32(max_value256, selected256);
+	}
+
+	// őlXJ[lɕϊB
+	int result[8];
+	_mm256_storeu_si256((__m256i*)result, max_value256);
+
+	int max_value = result[0];
+
+	for (int j = 1; j < 8; j++)
+	{
+		if (result[j] > max_value)
+		{
+			max_value = result[j];
+		}
+	}
+
+	// c̗vfB
+	for (; i < length; i++)
+	{
+		if ((bitmap[i / 8] & (1 << (i % 8))) && b[i] > max_value)
+		{
+			max_value = b[i];
+		}
+	}
+
+	return max_value;
+}
+
+// ėp߂gAa[i] op key 𖞂ʒu b[i] ̘a߂֐B
+int sum_where_general(const int a[], const int b[], int length, predicate op, int key)
+{
+	predicate_range range = make_predicate_range(op, key);
+	int sum = 0;
+
+	for (int i = 0; i < length; i++)
+	{
+		if (test_range_general(range, a[i]))
+		{
+			sum += b[i];
+		}
+	}
+
+	return sum;
+}
+
+// SIMD ߂gAa[i] op key 𖞂ʒu b[i] ̘a߂֐B
+// rbg}bv炸ɁAƏWv 1 ̃[vōsB
+int sum_where(const int a[], const int b[], int length, predicate op, int key)
+{
+	predicate_range range = make_predicate_range(op, key);
+	__m256i low256 = _mm256_set1_epi32(range.low);
+	__m256i high256 = _mm256_set1_epi32(range.high);
+	__m256i inside256 = _mm256_set1_epi32(range.invert ? 0 : -1);
+
+	int i = 0;
+	__m256i sum256 = _mm256_setzero_si256();
+
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i b256 = _mm256_loadu_si256((__m256i*)(&b[i]));
+		__m256i selected256 = test_range_epi32(a256, low256, high256, inside256);
+		sum256 = _mm256_add_epi32(sum256, _mm256_and_si256(b256, selected256));
+	}
+
+	// vlXJ[lɕϊB
+	__m256i sum256_permute = _mm256_permute2x128_si256(sum256, sum256, 1);
+	__m256i result256 = _mm256_hadd_epi32(sum256, sum256_permute);
+	result256 = _mm256_hadd_epi32(result256, result256);
+	result256 = _mm256_hadd_epi32(result256, result256);
+	int sum = _mm256_extract_epi32(result256, 0);
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		if (test_range_general(range, a[i]))
+		{
+			sum += b[i];
+		}
+	}
+
+	return sum;
+}
+
+// SIMD ߂gAa[i] op key 𖞂vf̐߂֐B
+int count_where(const int a[], int length, predicate op, int key)
+{
+	predicate_range range = make_predicate_range(op, key);
+	__m256i low256 = _mm256_set1_epi32(range.low);
+	__m256i high256 = _mm256_set1_epi32(range.high);
+	__m256i inside256 = _mm256_set1_epi32(range.invert ? 0 : -1);
+
+	int i = 0;
+	int count = 0;
+
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i selected256 = test_range_epi32(a256, low256, high256, inside256);
+		count += __popcnt(_mm256_movemask_ps(_mm256_castsi256_ps(selected256)));
+	}
+
+	// c̗vfB
+	for (; i < length; i++)
+	{
+		count += test_range_general(range, a[i]);
+	}
+
+	return count;
+}
+
+// SIMD ߂gAa[i] op key 𖞂ʒu b[i] ̍ŏl߂֐B
+// 1 Ȃꍇ INT_MAX ԂB
+int min_where(const int a[], const int b[], int length, predicate op, int key)
+{
+	predicate_range range = make_predicate_range(op, key);
+	__m256i low256 = _mm256_set1_epi32(range.low);
+	__m256i high256 = _mm256_set1_epi32(range.high);
+	__m256i inside256 = _mm256_set1_epi32(range.invert ? 0 : -1);
+	__m256i max256 = _mm256_set1_epi32(INT_MAX);
+
+	int i = 0;
+	__m256i min_value256 = max256;
+
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i b256 = _mm256_loadu_si256((__m256i*)(&b[i]));
+		__m256i selected256 = test_range_epi32(a256, low256, high256, inside256);
+		min_value256 = _mm256_min_epi32(min_value256, _mm256_blendv_epi8(max256, b256, selected256));
+	}
+
+	int result[8];
+	_mm256_storeu_si256((__m256i*)result, min_value256);
+
+	int min_value = result[0];
+
+	for (int j = 1; j < 8; j++)
+	{
+		if (result[j] < min_value)
+		{
+			min_value = result[j];
+		}
+	}
+
+	// c̗vfB
+	for (; i < length; i++)
+	{
+		if (test_range_general(range, a[i]) && b[i] < min_value)
+		{
+			min_value = b[i];
+		}
+	}
+
+	return min_value;
+}
+
+// SIMD ߂gAa[i] op key 𖞂ʒu b[i] ̍ől߂֐B
+// 1 Ȃꍇ INT_MIN ԂB
+int max_where(const int a[], const int b[], int length, predicate op, int key)
+{
+	predicate_range range = make_predicate_range(op, key);
+	__m256i low256 = _mm256_set1_epi32(range.low);
+	__m256i high256 = _mm256_set1_epi32(range.high);
+	__m256i inside256 = _mm256_set1_epi32(range.invert ? 0 : -1);
+	__m256i min256 = _mm256_set1_epi32(INT_MIN);
+
+	int i = 0;
+	__m256i max_value256 = min256;
+
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i b256 = _mm256_loadu_si256((__m256i*)(&b[i]));
+		__m256i selected256 = test_range_epi32(a256, low256, high256, inside256);
+		max_value256 = _mm256_max_epi32(max_value256, _mm256_blendv_epi8(min256, b256, selected256));
+	}
+
+	int result[8];
+	_mm256_storeu_si256((__m256i*)result, max_value256);
+
+	int max_value = result[0];
+
+	for (int j = 1; j < 8; j++)
+	{
+		if (result[j] > max_value)
+		{
+			max_value = result[j];
+		}
+	}
+
+	// c̗vfB
+	for (; i < length; i++)
+	{
+		if (test_range_general(range, a[i]) && b[i] > max_value)
+		{
+			max_value = b[i];
+		}
+	}
+
+	return max_value;
+}
+
+void print_bitmap(const char* name, const unsigned char bitmap[], int length, int count)
+{
+	printf("%s", name);
+
+	for (int i = 0; i < length; i++)
+	{
+		printf("%d", (bitmap[i / 8] >> (i % 8)) & 1);
+	}
+
+	printf(" (%d)\n", count);
+}
+
+int main(void)
+{
+	int a[] = { 5, 1, 9, 3, 7, 2, 8, 6, 4, 10, 0, 11 };
+	int b[] = { 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 110, 120 };
+	int length = sizeof(a) / sizeof(int);
+	int set[] = { 1, 4, 9 };
+	unsigned char bitmap[(sizeof(a) / sizeof(int) + 7) / 8];
+	int count;
+
+	count = filter_general(a, length, PREDICATE_GREATER, 5, bitmap);
+	print_bitmap("filter_general(a > 5):  ", bitmap, length, count);
+
+	count = filter(a, length, PREDICATE_GREATER, 5, bitmap);
+	print_bitmap("filter(a > 5):          ", bitmap, length, count);
+
+	printf("count_selected:          %d\n", count_selected(bitmap, length));
+	printf("sum_selected(b):         %d\n", sum_selected(b, length, bitmap));
+	printf("min_of_selected(b):      %d\n", min_of_selected(b, length, bitmap));
+	printf("max_of_selected(b):      %d\n\n", max_of_selected(b, length, bitmap));
+
+	count = filter(a, length, PREDICATE_NOT_EQUAL, 7, bitmap);
+	print_bitmap("filter(a != 7):         ", bitmap, length, count);
+
+	count = filter(a, length, PREDICATE_LESS_EQUAL, 3, bitmap);
+	print_bitmap("filter(a <= 3):         ", bitmap, length, count);
+
+	count = filter_range(a, length, 3, 8, bitmap);
+	print_bitmap("filter_range(3..8):     ", bitmap, length, count);
+
+	count = filter_in_set(a, length, set, sizeof(set) / sizeof(int), bitmap);
+	print_bitmap("filter_in_set(1, 4, 9): ", bitmap, length, count);
+
+	printf("\nsum_where_general(b, a > 5): %d\n", sum_where_general(a, b, length, PREDICATE_GREATER, 5));
+	printf("sum_where(b, a > 5):         %d\n", sum_where(a, b, length, PREDICATE_GREATER, 5));
+	printf("count_where(a > 5):          %d\n", count_where(a, length, PREDICATE_GREATER, 5));
+	printf("min_where(b, a > 5):         %d\n", min_where(a, b, length, PREDICATE_GREATER, 5));
+	printf("max_where(b, a > 5):         %d\n", max_where(a, b, length, PREDICATE_GREATER, 5));
+
+	return 0;
+}
@@ -4,8 +4,16 @@
 // https://zenn.dev/k_taro56/articles/simd-scalar-multiplication
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
 #include <intrin.h>
 
+// ̗vfȏ̍s̓LbVɎ܂ȂƂ݂ȂAXg[~OXgAgB
+#ifndef LARGE_INPUT_THRESHOLD
+#define LARGE_INPUT_THRESHOLD (1 << 20)
+#endif
+
 // ėp߂gAs̃XJ[{vZ֐B
 void scalar_multiplication_general(int* a, int row, int column, int scalar)
 {
@@ -19,11 +27,13 @@ void scalar_multiplication_general(int* a, int row, int column, int scalar)
 void scalar_multiplication(int* a, int row, int column, int scalar)
 {
 	int i = 0;
+	int length = row * column;
 
 	__m256i scalar256 = _mm256_set1_epi32(scalar);
 
 	// 8 vfvZB
-	for (; i < row * column; i += 8)
+	// vf 8 ̔{łȂꍇɁAzď܂Ȃ悤ɂB
+	for (; i + 7 < length; i += 8)
 	{
 		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
 		__m256i product256 = _mm256_mullo_epi32(a256, scalar256);
@@ -32,12 +42,82 @@ void scalar_multiplication(int* a, int row, int column, int scalar)
 
 	// c̗vfB
 	// ͔ėp߁B
-	for (; i < row * column; i++)
+	for (; i < length; i++)
 	{
 		a[i] *= scalar;
 	}
 }
 
+// SIMD ߂gAs a ̃XJ[{s result ɏފ֐B
+void scalar_multiplication_out_of_place(const int* a, int* result, int row, int column, int scalar)
+{
+	int i = 0;
+	int length = row * column;
+
+	__m256i scalar256 = _mm256_set1_epi32(scalar);
+
+	// 8 vfvZB
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i product256 = _mm256_mullo_epi32(a256, scalar256);
+		_mm256_storeu_si256((__m256i*)(&result[i]), product256);
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		result[i] = a[i] * scalar;
+	}
+}
+
+// SIMD ߂gAs a ̃XJ[{s result ɏފ֐B
+// 傫ȍsł́ALbVȂ悤ɃXg[~OXgAgB
+void scalar_multiplication_stream(const int* a, int* result, int row, int column, int scalar)
+{
+	int length = row * column;
+	int i = 0;
+
+	// LbVɎ܂傫̍śAʏ̃XgAgB
+	if (length < LARGE_INPUT_THRESHOLD)
+	{
+		scalar_multiplication_out_of_place(a, result, row, column, scalar);
+		return;
+	}
+
+	__m256i scalar256 = _mm256_set1_epi32(scalar);
+
+	// Xg[~OXgȀݐ 32 oCgEɑKvB
+	// E܂ł̗vf͔ėp߂ŏB
+	for (; i < length && ((uintptr_t)(&result[i]) & (sizeof(__m256i) - 1)) != 0; i++)
+	{
+		result[i] = a[i] * scalar;
+	}
+
+	// 8 vfvZB
+	// ǂݍ݂͘AĂ̂ŁAn[hEFAvtFb`ɔCB
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i product256 = _mm256_mullo_epi32(a256, scalar256);
+
+		// LbVoRɃ[֏ށB
+		// ݐ̓ǂݍ݁iRFOjȂB
+		_mm256_stream_si256((__m256i*)(&result[i]), product256);
+	}
+
+	// Xg[~OXgÅA㑱̃XgAOɕۏ؂B
+	_mm_sfence();
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		result[i] = a[i] * scalar;
+	}
+}
+
 #define ROW 4
 #define COLUMN 4
 
@@ -83,5 +163,58 @@ int main()
 		printf("\n");
 	}
 
+	int c[ROW][COLUMN] =
+	{
+		{ 1, 2, 3, 4 },
+		{ 5, 6, 7, 8 },
+		{ 9, 10, 11, 12 },
+		{ 13, 14, 15, 16 }
+	};
+	int d[ROW][COLUMN];
+
+	scalar_multiplication_stream((int*)c, (int*)d, 4, 4, 3);
+	printf("\nscalar_multiplication_stream:\n");
+
+	for (int row = 0; row < ROW; row++)
+	{
+		for (int column = 0; column < COLUMN; column++)
+		{
+			printf("%3d", d[row][column]);
+		}
+		printf("\n");
+	}
+
+	// LbVɎ܂Ȃ傫ȍsőxrB
+	int large_row = 4096;
+	int large_column = LARGE_INPUT_THRESHOLD / 64;
+	int large_length = large_row * large_column;
+	int* large_a = (int*)malloc(sizeof(int) * large_length);
+	int* large_b = (int*)malloc(sizeof(int) * large_length);
+
+	if (large_a == NULL || large_b == NULL)
+	{
+		free(large_a);
+		free(large_b);
+		return 1;
+	}
+
+	for (int i = 0; i < large_length; i++)
+	{
+		large_a[i] = i % 100;
+		large_b[i] = i % 100;
+	}
+
+	// oɑ΂āAʏ̃XgAƃXg[~OXgArB
+	clock_t start = clock();
+	scalar_multiplication_out_of_place(large_a, large_b, large_row, large_column, 3);
+	printf("\nscalar_multiplication_out_of_place: %ld ms\n", (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	scalar_multiplication_stream(large_a, large_b, large_row, large_column, 3);
+	printf("scalar_multiplication_stream:       %ld ms\n", (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	free(large_a);
+	free(large_b);
+
 	return 0;
 }
@@ -0,0 +1,636 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <intrin.h>
+
+// ގx̎ށB
+typedef enum
+{
+	// ρB傫قǎĂB
+	SIMILARITY_DOT_PRODUCT,
+	// [Nbh 2 BقǎĂB
+	SIMILARITY_SQUARED_L2,
+	// }nb^BقǎĂB
+	SIMILARITY_L1,
+	// RTCގxB傫قǎĂB
+	SIMILARITY_COSINE
+} similarity_metric;
+
+// xɃXRAvZ̐B
+// XRA L1 LbVɒu܂܏ k IԁB
+#define SCORE_BLOCK 256
+
+// ̂悤ɁAقǎĂwWǂ𔻒肷֐B
+int is_distance(similarity_metric metric)
+{
+	return metric == SIMILARITY_SQUARED_L2 || metric == SIMILARITY_L1;
+}
+
+// ėp߂gAxNg a  b ̗ގx߂֐B
+float similarity_general(similarity_metric metric, const int a[], const int b[], int dimension)
+{
+	int result = 0;
+	int squared_norm_a = 0;
+	int squared_norm_b = 0;
+
+	for (int i = 0; i < dimension; i++)
+	{
+		int difference = a[i] - b[i];
+
+		switch (metric)
+		{
+		case SIMILARITY_DOT_PRODUCT:
+			result += a[i] * b[i];
+			break;
+		case SIMILARITY_SQUARED_L2:
+			result += difference * difference;
+			break;
+		case SIMILARITY_L1:
+			result += difference < 0 ? -difference : difference;
+			break;
+		case SIMILARITY_COSINE:
+			result += a[i] * b[i];
+			squared_norm_a += a[i] * a[i];
+			squared_norm_b += b[i] * b[i];
+			break;
+		}
+	}
+
+	if (metric == SIMILARITY_COSINE)
+	{
+		float norm = sqrtf((float)squared_norm_a * (float)squared_norm_b);
+		return norm == 0.0f ? 0.0f : (float)result / norm;
+	}
+
+	return (float)result;
+}
+
+// 擪 count ̗vfLȃ}XN߂֐B
+__m256i tail_mask_epi32(int count)
+{
+	static const int mask_table[16] =
+	{
+		-1, -1, -1, -1, -1, -1, -1, -1,
+		0, 0, 0, 0, 0, 0, 0, 0
+	};
+
+	return _mm256_loadu_si256((__m256i*)(&mask_table[8 - count]));
+}
+
+// 4 {̃xNg̊evA1 { 128 rbgxNgɂ܂Ƃ߂֐B
+__m128i horizontal_add4_epi32(__m256i sum0, __m256i sum1, __m256i sum2, __m256i sum3)
+{
+	__m256i sum01 = _mm256_hadd_epi32(sum0, sum1);
+	__m256i sum23 = _mm256_hadd_epi32(sum2, sum3);
+	__m256i sum0123 = _mm256_hadd_epi32(sum01, sum23);
+	return _mm_add_epi32(_mm256_castsi256_si128(sum0123), _mm256_extracti128_si256(sum0123, 1));
+}
+
+// 1 {̃xNg̍v߂֐B
+int horizontal_add_epi32(__m256i sum256)
+{
+	__m128i sum128 = _mm_add_epi32(_mm256_castsi256_si128(sum256), _mm256_extracti128_si256(sum256, 1));
+	sum128 = _mm_hadd_epi32(sum128, sum128);
+	sum128 = _mm_hadd_epi32(sum128, sum128);
+	return _mm_cvtsi128_si32(sum128);
+}
+
+// ς̃XRAvZ֐B
+//  4 sAǂݍ query  4 sŎg񂷁B
+void score_dot_product(const int query[], const int candidates[], int count, int dimension, float scores[])
+{
+	__m256i mask256 = tail_mask_epi32(dimension % 8);
+	int i = 0;
+
+	for (; i + 3 < count; i += 4)
+	{
+		const int* c0 = &candidates[(size_t)(i + 0) * dimension];
+		const int* c1 = &candidates[(size_t)(i + 1) * dimension];
+		const int* c2 = &candidates[(size_t)(i + 2) * dimension];
+		const int* c3 = &candidates[(size_t)(i + 3) * dimension];
+
+		__m256i sum0 = _mm256_setzero_si256();
+		__m256i sum1 = _mm256_setzero_si256();
+		__m256i sum2 = _mm256_setzero_si256();
+		__m256i sum3 = _mm256_setzero_si256();
+
+		int j = 0;
+
+		for (; j + 7 < dimension; j += 8)
+		{
+			__m256i q256 = _mm256_loadu_si256((__m256i*)(&query[j]));
+			sum0 = _mm256_add_epi32(sum0, _mm256_mullo_epi32(q256, _mm256_loadu_si256((__m256i*)(&c0[j]))));
+			sum1 = _mm256_add_epi32(sum1, _mm256_mullo_epi32(q256, _mm256_loadu_si256((__m256i*)(&c1[j]))));
+			sum2 = _mm256_add_epi32(sum2, _mm256_mullo_epi32(q256, _mm256_loadu_si256((__m256i*)(&c2[j]))));
+			sum3 = _mm256_add_epi32(sum3, _mm256_mullo_epi32(q256, _mm256_loadu_si256((__m256i*)(&c3[j]))));
+		}
+
+		// c̗vf̓}XNtœǂݍށB
+		// ǂݍ܂Ȃvf 0 ɂȂ̂ŁAʂɉeȂB
+		if (j < dimension)
+		{
+			__m256i q256 = _mm256_maskload_epi32(&query[j], mask256);
+			sum0 = _mm256_add_epi32(sum0, _mm256_mullo_epi32(q256, _mm256_maskload_epi32(&c0[j], mask256)));
+			sum1 = _mm256_add_epi32(sum1, _mm256_mullo_epi32(q256, _mm256_maskload_epi32(&c1[j], mask256)));
+			sum2 = _mm256_add_epi32(sum2, _mm256_mullo_epi32(q256, _mm256_maskload_epi32(&c2[j], mask256)));
+			sum3 = _mm256_add_epi32(sum3, _mm256_mullo_epi32(q256, _mm256_maskload_epi32(&c3[j], mask256)));
+		}
+
+		__m128i result128 = horizontal_add4_epi32(sum0, sum1, sum2, sum3);
+		_mm_storeu_ps(&scores[i], _mm_cvtepi32_ps(result128));
+	}
+
+	// c̍sB
+	for (; i < count; i++)
+	{
+		const int* c = &candidates[(size_t)i * dimension];
+		__m256i sum256 = _mm256_setzero_si256();
+		int j = 0;
+
+		for (; j + 7 < dimension; j += 8)
+		{
+			__m256i q256 = _mm256_loadu_si256((__m256i*)(&query[j]));
+			sum256 = _mm256_add_epi32(sum256, _mm256_mullo_epi32(q256, _mm256_loadu_si256((__m256i*)(&c[j]))));
+		}
+
+		if (j < dimension)
+		{
+			__m256i q256 = _mm256_maskload_epi32(&query[j], mask256);
+			sum256 = _mm256_add_epi32(sum256, _mm256_mullo_epi32(q256, _mm256_maskload_epi32(&c[j], mask256)));
+		}
+
+		scores[i] = (float)horizontal_add_epi32(sum256);
+	}
+}
+
+//  2  sum ɉ֐B
+__m256i squared_l2_step(__m256i sum256, __m256i q256, __m256i c256)
+{
+	__m256i d256 = _mm256_sub_epi32(q256, c256);
+	return _mm256_add_epi32(sum256, _mm256_mullo_epi32(d256, d256));
+}
+
+// [Nbh 2 ̃XRAvZ֐B
+void score_squared_l2(const int query[], const int candidates[], int count, int dimension, float scores[])
+{
+	__m256i mask256 = tail_mask_epi32(dimension % 8);
+	int i = 0;
+
+	for (; i + 3 < count; i += 4)
+	{
+		const int* c0 = &candidates[(size_t)(i + 0) * dimension];
+		const int* c1 = &candidates[(size_t)(i + 1) * dimension];
+		const int* c2 = &candidates[(size_t)(i + 2) * dimension];
+		const int* c3 = &candidates[(size_t)(i + 3) * dimension];
+
+		__m256i sum0 = _mm256_setzero_si256();
+		__m256i sum1 = _mm256_setzero_si256();
+		__m256i sum2 = _mm256_setzero_si256();
+		__m256i sum3 = _mm256_setzero_si256();
+
+		int j = 0;
+
+		for (; j + 7 < dimension; j += 8)
+		{
+			__m256i q256 = _mm256_loadu_si256((__m256i*)(&query[j]));
+			sum0 = squared_l2_step(sum0, q256, _mm256_loadu_si256((__m256i*)(&c0[j])));
+			sum1 = squared_l2_step(sum1, q256, _mm256_loadu_si256((__m256i*)(&c1[j])));
+			sum2 = squared_l2_step(sum2, q256, _mm256_loadu_si256((__m256i*)(&c2[j])));
+			sum3 = squared_l2_step(sum3, q256, _mm256_loadu_si256((__m256i*)(&c3[j])));
+		}
+
+		// c̗vf}XNtŏB
+		if (j < dimension)
+		{
+			__m256i q256 = _mm256_maskload_epi32(&query[j], mask256);
+			sum0 = squared_l2_step(sum0, q256, _mm256_maskload_epi32(&c0[j], mask256));
+			sum1 = squared_l2_step(sum1, q256, _mm256_maskload_epi32(&c1[j], mask256));
+			sum2 = squared_l2_step(sum2, q256, _mm256_maskload_epi32(&c2[j], mask256));
+			sum3 = squared_l2_step(sum3, q256, _mm256_maskload_epi32(&c3[j], mask256));
+		}
+
+		__m128i result128 = horizontal_add4_epi32(sum0, sum1, sum2, sum3);
+		_mm_storeu_ps(&scores[i], _mm_cvtepi32_ps(result128));
+	}
+
+	// c̍sB
+	for (; i < count; i++)
+	{
+		const int* c = &candidates[(size_t)i * dimension];
+		__m256i sum256 = _mm256_setzero_si256();
+		int j = 0;
+
+		for (; j + 7 < dimension; j += 8)
+		{
+			sum256 = squared_l2_step(sum256, _mm256_loadu_si256((__m256i*)(&query[j])), _mm256_loadu_si256((__m256i*)(&c[j])));
+		}
+
+		if (j < dimension)
+		{
+			sum256 = squared_l2_step(sum256, _mm256_maskload_epi32(&query[j], mask256), _mm256_maskload_epi32(&c[j], mask256));
+		}
+
+		scores[i] = (float)horizontal_add_epi32(sum256);
+	}
+}
+
+// ̐Βl sum ɉ֐B
+__m256i l1_step(__m256i sum256, __m256i q256, __m256i c256)
+{
+	return _mm256_add_epi32(sum256, _mm256_abs_epi32(_mm256_sub_epi32(q256, c256)));
+}
+
+// }nb^̃XRAvZ֐B
+void score_l1(const int query[], const int candidates[], int count, int dimension, float scores[])
+{
+	__m256i mask256 = tail_mask_epi32(dimension % 8);
+	int i = 0;
+
+	for (; i + 3 < count; i += 4)
+	{
+		const int* c0 = &candidates[(size_t)(i + 0) * dimension];
+		const int* c1 = &candidates[(size_t)(i + 1) * dimension];
+		const int* c2 = &candidates[(size_t)(i + 2) * dimension];
+		const int* c3 = &candidates[(size_t)(i + 3) * dimension];
+
+		__m256i sum0 = _mm256_setzero_si256();
+		__m256i sum1 = _mm256_setzero_si256();
+		__m256i sum2 = _mm256_setzero_si256();
+		__m256i sum3 = _mm256_setzero_si256();
+
+		int j = 0;
+
+		for (; j + 7 < dimension; j += 8)
+		{
+			__m256i q256 = _mm256_loadu_si256((__m256i*)(&query[j]));
+			sum0 = l1_step(sum0, q256, _mm256_loadu_si256((__m256i*)(&c0[j])));
+			sum1 = l1_step(sum1, q256, _mm256_loadu_si256((__m256i*)(&c1[j])));
+			sum2 = l1_step(sum2, q256, _mm256_loadu_si256((__m256i*)(&c2[j])));
+			sum3 = l1_step(sum3, q256, _mm256_loadu_si256((__m256i*)(&c3[j])));
+		}
+
+		// c̗vf}XNtŏB
+		if (j < dimension)
+		{
+			__m256i q256 = _mm256_maskload_epi32(&query[j], mask256);
+			sum0 = l1_step(sum0, q256, _mm256_maskload_epi32(&c0[j], mask256));
+			sum1 = l1_step(sum1, q256, _mm256_maskload_epi32(&c1[j], mask256));
+			sum2 = l1_step(sum2, q256, _mm256_maskload_epi32(&c2[j], mask256));
+			sum3 = l1_step(sum3, q256, _mm256_maskload_epi32(&c3[j], mask256));
+		}
+
+		__m128i result128 = horizontal_add4_epi32(sum0, sum1, sum2, sum3);
+		_mm_storeu_ps(&scores[i], _mm_cvtepi32_ps(result128));
+	}
+
+	// c̍sB
+	for (; i < count; i++)
+	{
+		const int* c = &candidates[(size_t)i * dimension];
+		__m256i sum256 = _mm256_setzero_si256();
+		int j = 0;
+
+		for (; j + 7 < dimension; j += 8)
+		{
+			sum256 = l1_step(sum256, _mm256_loadu_si256((__m256i*)(&query[j])), _mm256_loadu_si256((__m256i*)(&c[j])));
+		}
+
+		if (j < dimension)
+		{
+			sum256 = l1_step(sum256, _mm256_maskload_epi32(&query[j], mask256), _mm256_maskload_epi32(&c[j], mask256));
+		}
+
+		scores[i] = (float)horizontal_add_epi32(sum256);
+	}
+}
+
+// ς dot ɁA̗vf 2  norm ɉ֐B
+void cosine_step(__m256i* dot256, __m256i* norm256, __m256i q256, __m256i c256)
+{
+	*dot256 = _mm256_add_epi32(*dot256, _mm256_mullo_epi32(q256, c256));
+	*norm256 = _mm256_add_epi32(*norm256, _mm256_mullo_epi32(c256, c256));
+}
+
+// RTCގx̃XRAvZ֐B
+// ςƌ̃m 1 ̓ǂݍ݂œɋ߂B
+void score_cosine(const int query[], const int candidates[], int count, int dimension, float scores[])
+{
+	__m256i mask256 = tail_mask_epi32(dimension % 8);
+	__m256i query_norm256 = _mm256_setzero_si256();
+	int j;
+
+	// query ̃m͍ŏ 1 񂾂vZB
+	for (j = 0; j + 7 < dimension; j += 8)
+	{
+		__m256i q256 = _mm256_loadu_si256((__m256i*)(&query[j]));
+		query_norm256 = _mm256_add_epi32(query_norm256, _mm256_mullo_epi32(q256, q256));
+	}
+
+	if (j < dimension)
+	{
+		__m256i q256 = _mm256_maskload_epi32(&query[j], mask256);
+		query_norm256 = _mm256_add_epi32(query_norm256, _mm256_mullo_epi32(q256, q256));
+	}
+
+	__m128 query_norm128 = _mm_set1_ps((float)horizontal_add_epi32(query_norm256));
+	int i = 0;
+
+	for (; i + 3 < count; i += 4)
+	{
+		const int* c0 = &candidates[(size_t)(i + 0) * dimension];
+		const int* c1 = &candidates[(size_t)(i + 1) * dimension];
+		const int* c2 = &candidates[(size_t)(i + 2) * dimension];
+		const int* c3 = &candidates[(size_t)(i + 3) * dimension];
+
+		__m256i dot0 = _mm256_setzero_si256();
+		__m256i dot1 = _mm256_setzero_si256();
+		__m256i dot2 = _mm256_setzero_si256();
+		__m256i dot3 = _mm256_setzero_si256();
+
+		__m256i norm0 = _mm256_setzero_si256();
+		__m256i norm1 = _mm256_setzero_si256();
+		__m256i norm2 = _mm256_setzero_si256();
+		__m256i norm3 = _mm256_setzero_si256();
+
+		for (j = 0; j + 7 < dimension; j += 8)
+		{
+			__m256i q256 = _mm256_loadu_si256((__m256i*)(&query[j]));
+			cosine_step(&dot0, &norm0, q256, _mm256_loadu_si256((__m256i*)(&c0[j])));
+			cosine_step(&dot1, &norm1, q256, _mm256_loadu_si256((__m256i*)(&c1[j])));
+			cosine_step(&dot2, &norm2, q256, _mm256_loadu_si256((__m256i*)(&c2[j])));
+			cosine_step(&dot3, &norm3, q256, _mm256_loadu_si256((__m256i*)(&c3[j])));
+		}
+
+		// c̗vf}XNtŏB
+		if (j < dimension)
+		{
+			__m256i q256 = _mm256_maskload_epi32(&query[j], mask256);
+			cosine_step(&dot0, &norm0, q256, _mm256_maskload_epi32(&c0[j], mask256));
+			cosine_step(&dot1, &norm1, q256, _mm256_maskload_epi32(&c1[j], mask256));
+			cosine_step(&dot2, &norm2, q256, _mm256_maskload_epi32(&c2[j], mask256));
+			cosine_step(&dot3, &norm3, q256, _mm256_maskload_epi32(&c3[j], mask256));
+		}
+
+		__m128 dot128 = _mm_cvtepi32_ps(horizontal_add4_epi32(dot0, dot1, dot2, dot3));
+		__m128 norm128 = _mm_cvtepi32_ps(horizontal_add4_epi32(norm0, norm1, norm2, norm3));
+
+		// m 0 ̃xNgƂ̗ގx 0 ƂB
+		__m128 denominator128 = _mm_sqrt_ps(_mm_mul_ps(query_norm128, norm128));
+		__m128 zero128 = _mm_cmpeq_ps(denominator128, _mm_setzero_ps());
+		__m128 result128 = _mm_andnot_ps(zero128, _mm_div_ps(dot128, denominator128));
+		_mm_storeu_ps(&scores[i], result128);
+	}
+
+	// c̍sB
+	for (; i < count; i++)
+	{
+		scores[i] = similarity_general(SIMILARITY_COSINE, query, &candidates[(size_t)i * dimension], dimension);
+	}
+}
+
+// SIMD ߂gAquery  count ̗̌ގx܂Ƃ߂ċ߂֐B
+// candidates  count s dimension ̍sŁA1 s 1 ̌B
+void compute_similarity(similarity_metric metric, const int query[], const int candidates[], int count, int dimension, float scores[])
+{
+	switch (metric)
+	{
+	case SIMILARITY_DOT_PRODUCT:
+		score_dot_product(query, candidates, count, dimension, scores);
+		break;
+	case SIMILARITY_SQUARED_L2:
+		score_squared_l2(query, candidates, count, dimension, scores);
+		break;
+	case SIMILARITY_L1:
+		score_l1(query, candidates, count, dimension, scores);
+		break;
+	case SIMILARITY_COSINE:
+		score_cosine(query, candidates, count, dimension, scores);
+		break;
+	}
+}
+
+// ǂɕ񂾏 k ̃XRAɁAVXRA}֐B
+// XRA͑傫قǗǂ̂ƂĈB
+void insert_top_k(float top_scores[], int top_indices[], int* top_count, int k, float score, int index)
+{
+	__m256 score256 = _mm256_set1_ps(score);
+	int position = 0;
+	int i = 0;
+
+	// score ȏ̃XRA̐𐔂āA}ʒu߂B
+	// XRA͐ɌD悷B
+	for (; i + 7 < *top_count; i += 8)
+	{
+		__m256 greater_equal256 = _mm256_cmp_ps(_mm256_loadu_ps(&top_scores[i]), score256, _CMP_GE_OQ);
+		position += __popcnt(_mm256_movemask_ps(greater_equal256));
+	}
+
+	for (; i < *top_count; i++)
+	{
+		position += top_scores[i] >= score;
+	}
+
+	int moved = (*top_count < k ? *top_count : k - 1) - position;
+
+	memmove(&top_scores[position + 1], &top_scores[position], sizeof(float) * moved);
+	memmove(&top_indices[position + 1], &top_indices[position], sizeof(int) * moved);
+	top_scores[position] = score;
+	top_indices[position] = index;
+
+	if (*top_count < k)
+	{
+		(*top_count)++;
+	}
+}
+
+// ėp߂gAquery ɍł k ̌߂֐B
+// ̐ԂB
+int search_top_k_general(similarity_metric metric, const int query[], const int candidates[], int count, int dimension, int k, int top_indices[], float top_scores[])
+{
+	float sign = is_distance(metric) ? -1.0f : 1.0f;
+	int top_count = 0;
+
+	for (int i = 0; i < count; i++)
+	{
+		float score = sign * similarity_general(metric, query, &candidates[(size_t)i * dimension], dimension);
+		int position = top_count;
+
+		while (position > 0 && top_scores[position - 1] < score)
+		{
+			if (position < k)
+			{
+				top_scores[position] = top_scores[position - 1];
+				top_indices[position] = top_indices[position - 1];
+			}
+
+			position--;
+		}
+
+		if (position < k)
+		{
+			top_scores[position] = score;
+			top_indices[position] = i;
+
+			if (top_count < k)
+			{
+				top_count++;
+			}
+		}
+	}
+
+	for (int i = 0; i < top_count; i++)
+	{
+		top_scores[i] *= sign;
+	}
+
+	return top_count;
+}
+
+// SIMD ߂gAquery ɍł k ̌߂֐B
+// ̐ԂB
+int search_top_k(similarity_metric metric, const int query[], const int candidates[], int count, int dimension, int k, int top_indices[], float top_scores[])
+{
+	float scores[SCORE_BLOCK];
+	int top_count = 0;
+
+	if (k <= 0)
+	{
+		return 0;
+	}
+
+	// ͕𔽓]A傫قǗǂXRAƂĈB
+	__m256 sign256 = _mm256_set1_ps(is_distance(metric) ? -0.0f : 0.0f);
+
+	for (int block = 0; block < count; block += SCORE_BLOCK)
+	{
+		int block_count = count - block < SCORE_BLOCK ? count - block : SCORE_BLOCK;
+
+		compute_similarity(metric, query, &candidates[(size_t)block * dimension], block_count, dimension, scores);
+
+		int i = 0;
+
+		for (; i + 7 < block_count; i += 8)
+		{
+			__m256 score256 = _mm256_xor_ps(_mm256_loadu_ps(&scores[i]), sign256);
+
+			//  k ̍ŉʂǂXRA}B
+			// قƂǂ̌͂ł܂Ƃ߂ēǂݔ΂B
+			__m256 threshold256 = _mm256_set1_ps(top_count < k ? -INFINITY : top_scores[k - 1]);
+			int mask = _mm256_movemask_ps(_mm256_cmp_ps(score256, threshold256, _CMP_GT_OQ));
+
+			if (mask == 0)
+			{
+				continue;
+			}
+
+			float candidate_scores[8];
+			_mm256_storeu_ps(candidate_scores, score256);
+
+			unsigned long lane;
+
+			while (_BitScanForward(&lane, mask))
+			{
+				mask &= mask - 1;
+
+				// }ɂ臒lオ̂ŁAxmFB
+				if (top_count < k || candidate_scores[lane] > top_scores[k - 1])
+				{
+					insert_top_k(top_scores, top_indices, &top_count, k, candidate_scores[lane], block + i + (int)lane);
+				}
+			}
+		}
+
+		// čB
+		for (; i < block_count; i++)
+		{
+			float score = is_distance(metric) ? -scores[i] : scores[i];
+
+			if (top_count < k || score > top_scores[k - 1])
+			{
+				insert_top_k(top_scores, top_indices, &top_count, k, score, block + i);
+			}
+		}
+	}
+
+	// ̕ɖ߂B
+	if (is_distance(metric))
+	{
+		for (int i = 0; i < top_count; i++)
+		{
+			top_scores[i] = -top_scores[i];
+		}
+	}
+
+	return top_count;
+}
+
+int main(void)
+{
+	const char* names[] = { "dot_product", "squared_l2", "l1", "cosine" };
+
+	int count = 200000;
+	int dimension = 100;
+	int k = 5;
+
+	int* candidates = (int*)malloc(sizeof(int) * count * dimension);
+	int* query = (int*)malloc(sizeof(int) * dimension);
+
+	if (candidates == NULL || query == NULL)
+	{
+		free(candidates);
+		free(query);
+		return 1;
+	}
+
+	srand(1);
+
+	for (int i = 0; i < count * dimension; i++)
+	{
+		candidates[i] = rand() % 201 - 100;
+	}
+
+	for (int i = 0; i < dimension; i++)
+	{
+		query[i] = rand() % 201 - 100;
+	}
+
+	for (int metric = SIMILARITY_DOT_PRODUCT; metric <= SIMILARITY_COSINE; metric++)
+	{
+		int top_indices[5];
+		float top_scores[5];
+
+		clock_t start = clock();
+		int found = search_top_k_general((similarity_metric)metric, query, candidates, count, dimension, k, top_indices, top_scores);
+		long elapsed = (long)((clock() - start) * 1000 / CLOCKS_PER_SEC);
+
+		printf("search_top_k_general (%s): %ld ms\n", names[metric], elapsed);
+
+		for (int i = 0; i < found; i++)
+		{
+			printf("  %6d: %g\n", top_indices[i], top_scores[i]);
+		}
+
+		start = clock();
+		found = search_top_k((similarity_metric)metric, query, candidates, count, dimension, k, top_indices, top_scores);
+		elapsed = (long)((clock() - start) * 1000 / CLOCKS_PER_SEC);
+
+		printf("search_top_k (%s): %ld ms\n", names[metric], elapsed);
+
+		for (int i = 0; i < found; i++)
+		{
+			printf("  %6d: %g\n", top_indices[i], top_scores[i]);
+		}
+
+		printf("\n");
+	}
+
+	free(candidates);
+	free(query);
+
+	return 0;
+}
@@ -0,0 +1,449 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <intrin.h>
+
+// axNg̓ς axpyiy = alpha * x + yj߂TvB
+// axNǵA0 łȂvf̈ʒuijƒl̑gŕ\B
+// Ԃ͎ł͂ȂA0 łȂvf̐ɔႷB
+
+// axNg\\́B
+// indices ͏ŁAʒu 2 񌻂ȂB
+typedef struct
+{
+	int* indices;
+	int* values;
+	int count;
+} sparse_vector;
+
+// xNgaxNg֐B
+sparse_vector sparse_vector_create(const int dense[], int dimension)
+{
+	sparse_vector vector = { NULL, NULL, 0 };
+
+	int count = 0;
+
+	for (int i = 0; i < dimension; i++)
+	{
+		count += dense[i] != 0;
+	}
+
+	vector.indices = (int*)malloc(sizeof(int) * (count > 0 ? count : 1));
+	vector.values = (int*)malloc(sizeof(int) * (count > 0 ? count : 1));
+
+	if (vector.indices == NULL || vector.values == NULL)
+	{
+		free(vector.indices);
+		free(vector.values);
+		vector.indices = NULL;
+		vector.values = NULL;
+		return vector;
+	}
+
+	for (int i = 0; i < dimension; i++)
+	{
+		if (dense[i] != 0)
+		{
+			vector.indices[vector.count] = i;
+			vector.values[vector.count] = dense[i];
+			vector.count++;
+		}
+	}
+
+	return vector;
+}
+
+void sparse_vector_free(sparse_vector* vector)
+{
+	free(vector->indices);
+	free(vector->values);
+	vector->indices = NULL;
+	vector->values = NULL;
+	vector->count = 0;
+}
+
+// 8 ̗vf̘a߂֐B
+int horizontal_add_epi32(__m256i sum256)
+{
+	__m256i sum256_permute = _mm256_permute2x128_si256(sum256, sum256, 1);
+	sum256 = _mm256_hadd_epi32(sum256, sum256_permute);
+	sum256 = _mm256_hadd_epi32(sum256, sum256);
+	sum256 = _mm256_hadd_epi32(sum256, sum256);
+	return _mm256_extract_epi32(sum256, 0);
+}
+
+// ėp߂gAaxNg a ƖxNg b ̓ς߂֐B
+int sparse_dense_dot_product_general(const sparse_vector* a, const int b[])
+{
+	int dot_product = 0;
+
+	for (int i = 0; i < a->count; i++)
+	{
+		dot_product += a->values[i] * b[a->indices[i]];
+	}
+
+	return dot_product;
+}
+
+// SIMD ߂gAaxNg a ƖxNg b ̓ς߂֐B
+// xNg̓MU[߂œǂݍށB
+int sparse_dense_dot_product(const sparse_vector* a, const int b[])
+{
+	int i = 0;
+
+	// v 0 ŏB
+	// MU[߂̑҂ԂB߁A2 ɕB
+	__m256i dot_product256_0 = _mm256_setzero_si256();
+	__m256i dot_product256_1 = _mm256_setzero_si256();
+
+	// evf 16 B
+	for (; i + 15 < a->count; i += 16)
+	{
+		__m256i index256_0 = _mm256_loadu_si256((__m256i*)(&a->indices[i]));
+		__m256i index256_1 = _mm256_loadu_si256((__m256i*)(&a->indices[i + 8]));
+		__m256i a256_0 = _mm256_loadu_si256((__m256i*)(&a->values[i]));
+		__m256i a256_1 = _mm256_loadu_si256((__m256i*)(&a->values[i + 8]));
+
+		__m256i b256_0 = _mm256_i32gather_epi32(b, index256_0, 4);
+		__m256i b256_1 = _mm256_i32gather_epi32(b, index256_1, 4);
+
+		dot_product256_0 = _mm256_add_epi32(dot_product256_0, _mm256_mullo_epi32(a256_0, b256_0));
+		dot_product256_1 = _mm256_add_epi32(dot_product256_1, _mm256_mullo_epi32(a256_1, b256_1));
+	}
+
+	int dot_product = horizontal_add_epi32(_mm256_add_epi32(dot_product256_0, dot_product256_1));
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < a->count; i++)
+	{
+		dot_product += a->values[i] * b[a->indices[i]];
+	}
+
+	return dot_product;
+}
+
+// ėp߂gAy = alpha * x + y ߂֐B
+// x ͑axNgAy ͖xNgB
+void sparse_axpy_general(int alpha, const sparse_vector* x, int y[])
+{
+	for (int i = 0; i < x->count; i++)
+	{
+		y[x->indices[i]] += alpha * x->values[i];
+	}
+}
+
+// AVX-512F  AVX-512VL g邩ǂ𒲂ׂ֐B
+// /arch:AVX512 w肵ȂĂ AVX-512 ̑gݍ݊֐̓RpCł̂ŁA
+// CPU  OS ΉĂ邩sɊmFĂĂяoB
+int avx512_available(void)
+{
+	static int available = -1;
+
+	if (available < 0)
+	{
+		int info[4];
+		available = 0;
+
+		__cpuid(info, 0);
+
+		if (info[0] >= 7)
+		{
+			__cpuid(info, 1);
+
+			// OS  XSAVE LɂĂāAYMMA}XNWX^[AZMM ̏Ԃۑ邱ƁB
+			if ((info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 0xE6) == 0xE6)
+			{
+				__cpuidex(info, 7, 0);
+
+				int f = (info[1] & (1 << 16)) != 0;
+				int vl = ((unsigned int)info[1] & (1u << 31)) != 0;
+				available = f && vl;
+			}
+		}
+	}
+
+	return available;
+}
+
+// SIMD ߂gAy = alpha * x + y ߂֐B
+// ʒu͏dȂ̂ŁA8 ܂Ƃ߂ăMU[߂œǂݍ݁AXLb^[߂ŏ߂Ă悢B
+// AVX2 ɂ̓XLb^[߂ȂAMU[̌ 1 łėp߂葬ȂȂ̂ŁA
+// AVX-512 gȂꍇ͔ėp߂̔łĂԁB
+void sparse_axpy(int alpha, const sparse_vector* x, int y[])
+{
+	if (!avx512_available())
+	{
+		sparse_axpy_general(alpha, x, y);
+		return;
+	}
+
+	__m256i alpha256 = _mm256_set1_epi32(alpha);
+
+	int i = 0;
+
+	// evf 8 B
+	for (; i + 7 < x->count; i += 8)
+	{
+		__m256i index256 = _mm256_loadu_si256((__m256i*)(&x->indices[i]));
+		__m256i x256 = _mm256_loadu_si256((__m256i*)(&x->values[i]));
+
+		__m256i y256 = _mm256_i32gather_epi32(y, index256, 4);
+		y256 = _mm256_add_epi32(y256, _mm256_mullo_epi32(alpha256, x256));
+
+		_mm256_i32scatter_epi32(y, index256, y256, 4);
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < x->count; i++)
+	{
+		y[x->indices[i]] += alpha * x->values[i];
+	}
+}
+
+// ėp߂gAaxNg a  b ̓ς߂֐B
+// ʒu̗擪˂킹B
+int sparse_dot_product_general(const sparse_vector* a, const sparse_vector* b)
+{
+	int dot_product = 0;
+
+	int i = 0;
+	int j = 0;
+
+	while (i < a->count && j < b->count)
+	{
+		int index_a = a->indices[i];
+		int index_b = b->indices[j];
+
+		if (index_a == index_b)
+		{
+			dot_product += a->values[i] * b->values[j];
+			i++;
+			j++;
+		}
+		else if (index_a < index_b)
+		{
+			i++;
+		}
+		else
+		{
+			j++;
+		}
+	}
+
+	return dot_product;
+}
+
+// SIMD ߂gAaxNg a  b ̓ς߂֐B
+// 8 ̈ʒũubN𑍓ŔrAvvf̐ς𑫂B
+int sparse_dot_product(const sparse_vector* a, const sparse_vector* b)
+{
+	int i = 0;
+	int j = 0;
+
+	// v 0 ŏB
+	__m256i dot_product256 = _mm256_setzero_si256();
+
+	while (i + 7 < a->count && j + 7 < b->count)
+	{
+		__m256i index_a256 = _mm256_loadu_si256((__m256i*)(&a->indices[i]));
+		__m256i index_b256 = _mm256_loadu_si256((__m256i*)(&b->indices[j]));
+		__m256i b256 = _mm256_loadu_si256((__m256i*)(&b->values[j]));
+
+		// b ̃ubN 8 ʂɂ炵 a ƔrB
+		// 128 rbg[̒ 4 ʂɉ񂵁A[ւ̂ł 4 ʂɉ񂷁B
+		// ʒu͏dȂ̂ŁAa ̊evfɈv b ̗vf͍X 1 B
+		// v b ̒lW߁AŌ 1 񂾂|B
+		__m256i index_b256_swap = _mm256_permute2x128_si256(index_b256, index_b256, 1);
+		__m256i b256_swap = _mm256_permute2x128_si256(b256, b256, 1);
+
+		__m256i matched256 = _mm256_and_si256(_mm256_cmpeq_epi32(index_a256, index_b256), b256);
+		matched256 = _mm256_or_si256(matched256, _mm256_and_si256(_mm256_cmpeq_epi32(index_a256, index_b256_swap), b256_swap));
+
+		for (int rotation = 1; rotation < 4; rotation++)
+		{
+			index_b256 = _mm256_shuffle_epi32(index_b256, _MM_SHUFFLE(0, 3, 2, 1));
+			b256 = _mm256_shuffle_epi32(b256, _MM_SHUFFLE(0, 3, 2, 1));
+			index_b256_swap = _mm256_shuffle_epi32(index_b256_swap, _MM_SHUFFLE(0, 3, 2, 1));
+			b256_swap = _mm256_shuffle_epi32(b256_swap, _MM_SHUFFLE(0, 3, 2, 1));
+
+			matched256 = _mm256_or_si256(matched256, _mm256_and_si256(_mm256_cmpeq_epi32(index_a256, index_b256), b256));
+			matched256 = _mm256_or_si256(matched256, _mm256_and_si256(_mm256_cmpeq_epi32(index_a256, index_b256_swap), b256_swap));
+		}
+
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a->values[i]));
+		dot_product256 = _mm256_add_epi32(dot_product256, _mm256_mullo_epi32(a256, matched256));
+
+		// Ō̈ʒũubŃAȏvvfȂ̂Ŏɐi߂B
+		int last_a = a->indices[i + 7];
+		int last_b = b->indices[j + 7];
+
+		i += last_a <= last_b ? 8 : 0;
+		j += last_b <= last_a ? 8 : 0;
+	}
+
+	int dot_product = horizontal_add_epi32(dot_product256);
+
+	// c̗vfB
+	// ͔ėp߁B
+	while (i < a->count && j < b->count)
+	{
+		int index_a = a->indices[i];
+		int index_b = b->indices[j];
+
+		if (index_a == index_b)
+		{
+			dot_product += a->values[i] * b->values[j];
+			i++;
+			j++;
+		}
+		else if (index_a < index_b)
+		{
+			i++;
+		}
+		else
+		{
+			j++;
+		}
+	}
+
+	return dot_product;
+}
+
+// ėp߂gAxNg̓ς߂֐B
+// axNg𖧂ɂĂ狁߂ꍇƂ̔rpB
+int dot_product_general(const int a[], const int b[], int length)
+{
+	int dot_product = 0;
+
+	for (int i = 0; i < length; i++)
+	{
+		dot_product += a[i] * b[i];
+	}
+
+	return dot_product;
+}
+
+// 0 łȂvf density ̊Ŋ܂ށA_ȖxNg֐B
+void fill_random_sparse(int a[], int dimension, double density)
+{
+	for (int i = 0; i < dimension; i++)
+	{
+		a[i] = (double)rand() / RAND_MAX < density ? rand() % 19 - 9 : 0;
+	}
+}
+
+int main(void)
+{
+	int a[] = { 0, 3, 0, 0, 1, 0, 0, 0, 2, 0, 0, 5, 0, 0, 0, 0, 7, 0, 0, 4 };
+	int b[] = { 1, 2, 0, 0, 3, 0, 1, 0, 0, 0, 0, 6, 0, 0, 2, 0, 1, 0, 0, 0 };
+	int dimension = sizeof(a) / sizeof(a[0]);
+
+	sparse_vector sparse_a = sparse_vector_create(a, dimension);
+	sparse_vector sparse_b = sparse_vector_create(b, dimension);
+
+	printf("dot_product_general:              %d\n", dot_product_general(a, b, dimension));
+	printf("sparse_dense_dot_product_general: %d\n", sparse_dense_dot_product_general(&sparse_a, b));
+	printf("sparse_dense_dot_product:         %d\n", sparse_dense_dot_product(&sparse_a, b));
+	printf("sparse_dot_product_general:       %d\n", sparse_dot_product_general(&sparse_a, &sparse_b));
+	printf("sparse_dot_product:               %d\n", sparse_dot_product(&sparse_a, &sparse_b));
+
+	int y[20] = { 0 };
+	sparse_axpy(2, &sparse_a, y);
+	printf("sparse_axpy(2, a, 0):            ");
+
+	for (int i = 0; i < dimension; i++)
+	{
+		printf(" %d", y[i]);
+	}
+
+	printf("\n");
+
+	sparse_vector_free(&sparse_a);
+	sparse_vector_free(&sparse_b);
+
+	// 傫ȑaxNgőxrB
+	// xNg̓ς͎ɁAaxNg̓ς 0 łȂvf̐ɔႷB
+	int large_dimension = 1 << 24;
+	int* large_a = (int*)malloc(sizeof(int) * large_dimension);
+	int* large_b = (int*)malloc(sizeof(int) * large_dimension);
+
+	if (large_a == NULL || large_b == NULL)
+	{
+		free(large_a);
+		free(large_b);
+		return 1;
+	}
+
+	fill_random_sparse(large_a, large_dimension, 0.05);
+	fill_random_sparse(large_b, large_dimension, 0.05);
+
+	sparse_a = sparse_vector_create(large_a, large_dimension);
+	sparse_b = sparse_vector_create(large_b, large_dimension);
+
+	clock_t start = clock();
+	int result = dot_product_general(large_a, large_b, large_dimension);
+	printf("\ndot_product_general:              %d (%ld ms)\n", result, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	result = sparse_dense_dot_product_general(&sparse_a, large_b);
+	printf("sparse_dense_dot_product_general: %d (%ld ms)\n", result, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	result = sparse_dense_dot_product(&sparse_a, large_b);
+	printf("sparse_dense_dot_product:         %d (%ld ms)\n", result, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	result = sparse_dot_product_general(&sparse_a, &sparse_b);
+	printf("sparse_dot_product_general:       %d (%ld ms)\n", result, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	start = clock();
+	result = sparse_dot_product(&sparse_a, &sparse_b);
+	printf("sparse_dot_product:               %d (%ld ms)\n", result, (long)((clock() - start) * 1000 / CLOCKS_PER_SEC));
+
+	// axpy  y ̂ŁAꂼ b ̎ʂ 100 񑫂ĎԂ𑪂B
+	// ʂ b Ƃ̓ςŔׂB
+	int* y_general = (int*)malloc(sizeof(int) * large_dimension);
+	int* y_simd = (int*)malloc(sizeof(int) * large_dimension);
+
+	if (y_general != NULL && y_simd != NULL)
+	{
+		memcpy(y_general, large_b, sizeof(int) * large_dimension);
+		memcpy(y_simd, large_b, sizeof(int) * large_dimension);
+
+		start = clock();
+
+		for (int repeat = 0; repeat < 100; repeat++)
+		{
+			sparse_axpy_general(2, &sparse_a, y_general);
+		}
+
+		long milliseconds = (long)((clock() - start) * 1000 / CLOCKS_PER_SEC);
+		printf("sparse_axpy_general:              %d (%ld ms)\n", dot_product_general(y_general, large_b, large_dimension), milliseconds);
+
+		start = clock();
+
+		for (int repeat = 0; repeat < 100; repeat++)
+		{
+			sparse_axpy(2, &sparse_a, y_simd);
+		}
+
+		milliseconds = (long)((clock() - start) * 1000 / CLOCKS_PER_SEC);
+		printf("sparse_axpy:                      %d (%ld ms)\n", dot_product_general(y_simd, large_b, large_dimension), milliseconds);
+	}
+
+	free(y_general);
+	free(y_simd);
+
+	sparse_vector_free(&sparse_a);
+	sparse_vector_free(&sparse_b);
+	free(large_a);
+	free(large_b);
+
+	return 0;
+}
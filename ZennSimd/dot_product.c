@@ -0,0 +1,37 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include "zenn_simd_internal.h"
+
+// xNg a  b ̓ς߂֐B
+// _mm256_mul_epi32 ͋Ԗڂ̗vfǂ 64 rbg̐ς߂̂ŁA
+// Ԗڂ̗vf 32 rbgEɂ炵Ă|B
+long long zenn_simd_dot_product(const int a[], const int b[], size_t length)
+{
+	size_t i = 0;
+
+	// v 0 ŏB
+	__m256i even256 = _mm256_setzero_si256();
+	__m256i odd256 = _mm256_setzero_si256();
+
+	// evf 8 B
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i b256 = _mm256_loadu_si256((__m256i*)(&b[i]));
+
+		even256 = _mm256_add_epi64(even256, _mm256_mul_epi32(a256, b256));
+		odd256 = _mm256_add_epi64(odd256, _mm256_mul_epi32(_mm256_srli_epi64(a256, 32), _mm256_srli_epi64(b256, 32)));
+	}
+
+	long long dot_product = zenn_simd_horizontal_add_epi64(_mm256_add_epi64(even256, odd256));
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		dot_product += (long long)a[i] * b[i];
+	}
+
+	return dot_product;
+}
@@ -0,0 +1,64 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include "zenn_simd_internal.h"
+
+// 32 rbgt 8 ̗vfxNg̒Aŏɕ̗vfCfbNX߂֐B
+static unsigned long find_first_non_zero_index_epi32(__m256i a)
+{
+	unsigned long index;
+	int mask = _mm256_movemask_ps(_mm256_castsi256_ps(a));
+	_BitScanForward(&index, mask);
+	return index;
+}
+
+// IndexOf  index_of_fast ƓA͍Ō 8 vfdēǂݍŏB
+size_t zenn_simd_index_of(const int a[], size_t length, int key)
+{
+	size_t i;
+
+	// z̗vf 8 ̏ꍇ́Aėp߂gB
+	if (length < 8)
+	{
+		for (i = 0; i < length; i++)
+		{
+			if (key == a[i])
+			{
+				return i;
+			}
+		}
+
+		return ZENN_SIMD_NOT_FOUND;
+	}
+
+	__m256i key256 = _mm256_set1_epi32(key);
+
+	// evf 8 B
+	for (i = 0; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i equals256 = _mm256_cmpeq_epi32(a256, key256);
+
+		// 8 ̗vf̒ key Ɠvf邩ǂ𔻒B
+		if (!_mm256_testz_si256(equals256, equals256))
+		{
+			return i + find_first_non_zero_index_epi32(equals256);
+		}
+	}
+
+	// c̗vfB
+	// z̈ꕔdĒT邱ƂɂȂ邪Adɂ key ȂƂĂB
+	if (length % 8 != 0)
+	{
+		i = length - 8;
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i equals256 = _mm256_cmpeq_epi32(a256, key256);
+
+		if (!_mm256_testz_si256(equals256, equals256))
+		{
+			return i + find_first_non_zero_index_epi32(equals256);
+		}
+	}
+
+	return ZENN_SIMD_NOT_FOUND;
+}
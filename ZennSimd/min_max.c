@@ -0,0 +1,105 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <limits.h>
+#include "zenn_simd_internal.h"
+
+// MinOfMaxOf  min_of_fast ƓA͍Ō 8 vfdēǂݍŏB
+int zenn_simd_min_of(const int a[], size_t length)
+{
+	size_t i;
+	int min_value;
+	__m256i min_value256;
+
+	// z̗vf 8 ̏ꍇ́Aėp߂gB
+	if (length < 8)
+	{
+		min_value = INT_MAX;
+
+		for (i = 0; i < length; i++)
+		{
+			if (a[i] < min_value)
+			{
+				min_value = a[i];
+			}
+		}
+
+		return min_value;
+	}
+
+	i = 8;
+	min_value256 = _mm256_loadu_si256((__m256i*)(&a[0]));
+
+	// evf 8 B
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		min_value256 = _mm256_min_epi32(min_value256, a256);
+	}
+
+	// c̗vfB
+	// z̈ꕔdĒT邱ƂɂȂ邪Aʂɉe͂ȂB
+	if (length % 8 != 0)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[length - 8]));
+		min_value256 = _mm256_min_epi32(min_value256, a256);
+	}
+
+	// ŏlXJ[lɕϊB
+	__m256i swapped256 = _mm256_permute2x128_si256(min_value256, min_value256, 1);
+	min_value256 = _mm256_min_epi32(min_value256, swapped256);
+	min_value256 = _mm256_min_epi32(min_value256, _mm256_shuffle_epi32(min_value256, _MM_SHUFFLE(1, 0, 3, 2)));
+	min_value256 = _mm256_min_epi32(min_value256, _mm256_shuffle_epi32(min_value256, _MM_SHUFFLE(2, 3, 0, 1)));
+
+	return _mm256_extract_epi32(min_value256, 0);
+}
+
+// MinOfMaxOf  max_of_fast ƓA͍Ō 8 vfdēǂݍŏB
+int zenn_simd_max_of(const int a[], size_t length)
+{
+	size_t i;
+	int max_value;
+	__m256i max_value256;
+
+	// z̗vf 8 ̏ꍇ́Aėp߂gB
+	if (length < 8)
+	{
+		max_value = INT_MIN;
+
+		for (i = 0; i < length; i++)
+		{
+			if (a[i] > max_value)
+			{
+				max_value = a[i];
+			}
+		}
+
+		return max_value;
+	}
+
+	i = 8;
+	max_value256 = _mm256_loadu_si256((__m256i*)(&a[0]));
+
+	// evf 8 B
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		max_value256 = _mm256_max_epi32(max_value256, a256);
+	}
+
+	// c̗vfB
+	// z̈ꕔdĒT邱ƂɂȂ邪Aʂɉe͂ȂB
+	if (length % 8 != 0)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[length - 8]));
+		max_value256 = _mm256_max_epi32(max_value256, a256);
+	}
+
+	// őlXJ[lɕϊB
+	__m256i swapped256 = _mm256_permute2x128_si256(max_value256, max_value256, 1);
+	max_value256 = _mm256_max_epi32(max_value256, swapped256);
+	max_value256 = _mm256_max_epi32(max_value256, _mm256_shuffle_epi32(max_value256, _MM_SHUFFLE(1, 0, 3, 2)));
+	max_value256 = _mm256_max_epi32(max_value256, _mm256_shuffle_epi32(max_value256, _MM_SHUFFLE(2, 3, 0, 1)));
+
+	return _mm256_extract_epi32(max_value256, 0);
+}
@@ -0,0 +1,75 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <stdint.h>
+#include "zenn_simd_internal.h"
+
+// vf size_t ŋ߂̂ŁArow * column  int ͈̔͂𒴂ĂłB
+void zenn_simd_scalar_multiplication(int* a, size_t row, size_t column, int scalar)
+{
+	size_t i = 0;
+	size_t length = row * column;
+
+	__m256i scalar256 = _mm256_set1_epi32(scalar);
+
+	// 8 vfvZB
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i product256 = _mm256_mullo_epi32(a256, scalar256);
+		_mm256_storeu_si256((__m256i*)(&a[i]), product256);
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		a[i] *= scalar;
+	}
+}
+
+void zenn_simd_scalar_multiplication_stream(const int* a, int* result, size_t row, size_t column, int scalar)
+{
+	size_t i = 0;
+	size_t length = row * column;
+
+	__m256i scalar256 = _mm256_set1_epi32(scalar);
+
+	// LbVɎ܂Ȃ傫̍śAXg[~OXgAgB
+	if (length >= LARGE_INPUT_THRESHOLD)
+	{
+		// Xg[~OXgȀݐ 32 oCgEɑKvB
+		// E܂ł̗vf͔ėp߂ŏB
+		for (; i < length && ((uintptr_t)(&result[i]) & (sizeof(__m256i) - 1)) != 0; i++)
+		{
+			result[i] = a[i] * scalar;
+		}
+
+		for (; i + 7 < length; i += 8)
+		{
+			__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+			__m256i product256 = _mm256_mullo_epi32(a256, scalar256);
+
+			// LbVoRɃ[֏ށB
+			_mm256_stream_si256((__m256i*)(&result[i]), product256);
+		}
+
+		// Xg[~OXgÅA㑱̃XgAOɕۏ؂B
+		_mm_sfence();
+	}
+
+	// 8 vfvZB
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_loadu_si256((__m256i*)(&a[i]));
+		__m256i product256 = _mm256_mullo_epi32(a256, scalar256);
+		_mm256_storeu_si256((__m256i*)(&result[i]), product256);
+	}
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		result[i] = a[i] * scalar;
+	}
+}
@@ -0,0 +1,216 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <math.h>
+#include "zenn_simd_internal.h"
+
+// ς̕ς@́AςL傫ƌB
+// Ⴆ 1e8 + i % 10  800 ̕U 8.25 A8.0 ɂȂB
+// ̘aAvf 1e8 xȂ 900 قǂ 64 rbg𒴂B
+// ŁASĂ̒lŏ̗vfĂa߂B
+// 炵l̘aƐϘa͕tAa͕Ȃ 64 rbgɎ܂͈͂ŁAmɋ܂B
+
+// 8  32 rbg shift A64 rbg 2 ̃xNgɂ֐B
+//  32 rbgɎ܂ȂƂ̂ŁA64 rbgɍLĂB
+static void subtract_epi64(__m256i a256, __m256i shift256, __m256i* low256, __m256i* high256)
+{
+	*low256 = _mm256_sub_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(a256)), shift256);
+	*high256 = _mm256_sub_epi64(_mm256_cvtepi32_epi64(_mm256_extracti128_si256(a256, 1)), shift256);
+}
+
+// 4 g 64 rbg̐ς𑫂֐B
+// evf̐Βl 2^32 Ȃ̂ŁAΒlǂ𕄍Ȃ 32 rbg̏ZŊ|AŌɕtB
+// r 64 rbg𒴂ĂAŏIIȘa 64 rbgɎ܂ΐlɂȂB
+static __m256i multiply_add_epi64(__m256i sum256, __m256i a256, __m256i b256)
+{
+	__m256i zero256 = _mm256_setzero_si256();
+	__m256i sign_a256 = _mm256_cmpgt_epi64(zero256, a256);
+	__m256i sign_b256 = _mm256_cmpgt_epi64(zero256, b256);
+	__m256i absolute_a256 = _mm256_sub_epi64(_mm256_xor_si256(a256, sign_a256), sign_a256);
+	__m256i absolute_b256 = _mm256_sub_epi64(_mm256_xor_si256(b256, sign_b256), sign_b256);
+
+	__m256i sign256 = _mm256_xor_si256(sign_a256, sign_b256);
+	__m256i product256 = _mm256_mul_epu32(absolute_a256, absolute_b256);
+	product256 = _mm256_sub_epi64(_mm256_xor_si256(product256, sign256), sign256);
+
+	return _mm256_add_epi64(sum256, product256);
+}
+
+// z a  shift l̘aƓa߂֐B
+static void sums_of(const int a[], size_t length, long long shift, long long* sum, unsigned long long* squared_sum)
+{
+	size_t i = 0;
+
+	__m256i shift256 = _mm256_set1_epi64x(shift);
+
+	// vl 0 ŏB
+	__m256i sum256 = _mm256_setzero_si256();
+	__m256i squared_sum256 = _mm256_setzero_si256();
+
+	// evf 8 B
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i low256;
+		__m256i high256;
+		subtract_epi64(_mm256_loadu_si256((__m256i*)(&a[i])), shift256, &low256, &high256);
+
+		sum256 = _mm256_add_epi64(sum256, _mm256_add_epi64(low256, high256));
+		squared_sum256 = multiply_add_epi64(squared_sum256, low256, low256);
+		squared_sum256 = multiply_add_epi64(squared_sum256, high256, high256);
+	}
+
+	// 64 rbg𒴂r̒lĂ߂悤ɁAȂőB
+	unsigned long long sum_u = (unsigned long long)zenn_simd_horizontal_add_epi64(sum256);
+	unsigned long long squared_sum_u = (unsigned long long)zenn_simd_horizontal_add_epi64(squared_sum256);
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		unsigned long long d = (unsigned long long)(a[i] - shift);
+		sum_u += d;
+		squared_sum_u += d * d;
+	}
+
+	*sum = (long long)sum_u;
+	*squared_sum = squared_sum_u;
+}
+
+// z a  b  shift_a  shift_b l̘aAaAϘa߂֐B
+static void sums_of_pair(const int a[], const int b[], size_t length, long long shift_a, long long shift_b,
+	long long* sum_a, long long* sum_b, unsigned long long* squared_sum_a, unsigned long long* squared_sum_b, long long* multiply_add)
+{
+	size_t i = 0;
+
+	__m256i shift_a256 = _mm256_set1_epi64x(shift_a);
+	__m256i shift_b256 = _mm256_set1_epi64x(shift_b);
+
+	// vl 0 ŏB
+	__m256i sum_a256 = _mm256_setzero_si256();
+	__m256i sum_b256 = _mm256_setzero_si256();
+	__m256i squared_sum_a256 = _mm256_setzero_si256();
+	__m256i squared_sum_b256 = _mm256_setzero_si256();
+	__m256i multiply_add256 = _mm256_setzero_si256();
+
+	// evf 8 B
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a_low256;
+		__m256i a_high256;
+		__m256i b_low256;
+		__m256i b_high256;
+		subtract_epi64(_mm256_loadu_si256((__m256i*)(&a[i])), shift_a256, &a_low256, &a_high256);
+		subtract_epi64(_mm256_loadu_si256((__m256i*)(&b[i])), shift_b256, &b_low256, &b_high256);
+
+		sum_a256 = _mm256_add_epi64(sum_a256, _mm256_add_epi64(a_low256, a_high256));
+		sum_b256 = _mm256_add_epi64(sum_b256, _mm256_add_epi64(b_low256, b_high256));
+
+		squared_sum_a256 = multiply_add_epi64(squared_sum_a256, a_low256, a_low256);
+		squared_sum_a256 = multiply_add_epi64(squared_sum_a256, a_high256, a_high256);
+		squared_sum_b256 = multiply_add_epi64(squared_sum_b256, b_low256, b_low256);
+		squared_sum_b256 = multiply_add_epi64(squared_sum_b256, b_high256, b_high256);
+		multiply_add256 = multiply_add_epi64(multiply_add256, a_low256, b_low256);
+		multiply_add256 = multiply_add_epi64(multiply_add256, a_high256, b_high256);
+	}
+
+	unsigned long long sum_a_u = (unsigned long long)zenn_simd_horizontal_add_epi64(sum_a256);
+	unsigned long long sum_b_u = (unsigned long long)zenn_simd_horizontal_add_epi64(sum_b256);
+	unsigned long long squared_sum_a_u = (unsigned long long)zenn_simd_horizontal_add_epi64(squared_sum_a256);
+	unsigned long long squared_sum_b_u = (unsigned long long)zenn_simd_horizontal_add_epi64(squared_sum_b256);
+	unsigned long long multiply_add_u = (unsigned long long)zenn_simd_horizontal_add_epi64(multiply_add256);
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		unsigned long long da = (unsigned long long)(a[i] - shift_a);
+		unsigned long long db = (unsigned long long)(b[i] - shift_b);
+		sum_a_u += da;
+		sum_b_u += db;
+		squared_sum_a_u += da * da;
+		squared_sum_b_u += db * db;
+		multiply_add_u += da * db;
+	}
+
+	*sum_a = (long long)sum_a_u;
+	*sum_b = (long long)sum_b_u;
+	*squared_sum_a = squared_sum_a_u;
+	*squared_sum_b = squared_sum_b_u;
+	*multiply_add = (long long)multiply_add_u;
+}
+
+double zenn_simd_dispersion(const int a[], size_t length)
+{
+	if (length == 0)
+	{
+		return NAN;
+	}
+
+	long long sum;
+	unsigned long long squared_sum;
+	sums_of(a, length, a[0], &sum, &squared_sum);
+
+	// 炵ĂU͕ςȂB
+	double average = (double)sum / length;
+	double squared_average = (double)squared_sum / length;
+
+	return squared_average - (average * average);
+}
+
+double zenn_simd_covariance(const int a[], const int b[], size_t length)
+{
+	if (length == 0)
+	{
+		return NAN;
+	}
+
+	long long sum_a;
+	long long sum_b;
+	unsigned long long squared_sum_a;
+	unsigned long long squared_sum_b;
+	long long multiply_add;
+	sums_of_pair(a, b, length, a[0], b[0], &sum_a, &sum_b, &squared_sum_a, &squared_sum_b, &multiply_add);
+
+	double average_multiply = (double)multiply_add / length;
+	double average_a = (double)sum_a / length;
+	double average_b = (double)sum_b / length;
+
+	return average_multiply - (average_a * average_b);
+}
+
+double zenn_simd_correlation_coefficient(const int a[], const int b[], size_t length)
+{
+	if (length == 0)
+	{
+		return NAN;
+	}
+
+	long long sum_a;
+	long long sum_b;
+	unsigned long long squared_sum_a;
+	unsigned long long squared_sum_b;
+	long long multiply_add;
+	sums_of_pair(a, b, length, a[0], b[0], &sum_a, &sum_b, &squared_sum_a, &squared_sum_b, &multiply_add);
+
+	// ςvZB
+	double average_multiply = (double)multiply_add / length;
+
+	double average_a = (double)sum_a / length;
+	double average_b = (double)sum_b / length;
+
+	double average_square_a = (double)squared_sum_a / length;
+	double average_square_b = (double)squared_sum_b / length;
+
+	// UvZB
+	double variance_a = average_square_a - (average_a * average_a);
+	double variance_b = average_square_b - (average_b * average_b);
+
+	// UvZB
+	double covariance = average_multiply - (average_a * average_b);
+
+	// W΍vZB
+	double standard_deviation_a = sqrt(variance_a);
+	double standard_deviation_b = sqrt(variance_b);
+
+	return covariance / (standard_deviation_a * standard_deviation_b);
+}
@@ -0,0 +1,44 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <limits.h>
+#include "zenn_simd_internal.h"
+
+// z a ̑Svf̘a߂֐B
+// rbg𔽓]ƁAevf 0  2^32 - 1 ̕ȂɂȂB
+// 64 rbg̃[̉ʂƏʂ 32 rbgʁXɑAŌ 2^31 * vfB
+// gi_mm256_cvtepi32_epi64jgs|[gAB
+long long zenn_simd_sum(const int a[], size_t length)
+{
+	size_t i = 0;
+
+	__m256i sign256 = _mm256_set1_epi32(INT_MIN);
+	__m256i low256 = _mm256_set1_epi64x(0xFFFFFFFF);
+
+	// vl 0 ŏB
+	// Z̈ˑ֌Wf؂邽߁A2 ɕB
+	__m256i sum256_0 = _mm256_setzero_si256();
+	__m256i sum256_1 = _mm256_setzero_si256();
+
+	// evf 8 B
+	for (; i + 7 < length; i += 8)
+	{
+		__m256i a256 = _mm256_xor_si256(_mm256_loadu_si256((__m256i*)(&a[i])), sign256);
+
+		sum256_0 = _mm256_add_epi64(sum256_0, _mm256_and_si256(a256, low256));
+		sum256_1 = _mm256_add_epi64(sum256_1, _mm256_srli_epi64(a256, 32));
+	}
+
+	// r̘at 64 rbg͈̔͂𒴂ĂAȂňΐaɂȂB
+	unsigned long long biased_sum = (unsigned long long)zenn_simd_horizontal_add_epi64(_mm256_add_epi64(sum256_0, sum256_1));
+	long long sum = (long long)(biased_sum - ((unsigned long long)i << 31));
+
+	// c̗vfB
+	// ͔ėp߁B
+	for (; i < length; i++)
+	{
+		sum += a[i];
+	}
+
+	return sum;
+}
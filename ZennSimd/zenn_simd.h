@@ -0,0 +1,141 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#ifndef ZENN_SIMD_H
+#define ZENN_SIMD_H
+
+#include <stddef.h>
+
+// eTv̊֐ÃvOg悤ɂ܂Ƃ߂CuB
+// vf size_t Ŏ󂯎̂ŁA2^31 ȏ̗vfzB
+// ̘a 64 rbgő̂ŁArŌӂꂵɂB
+// AVX2 ɑΉ CPU KvB
+
+// index_of  key ȂƂ̖߂lB
+#define ZENN_SIMD_NOT_FOUND ((size_t)-1)
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// z a ̑Svf̘a߂֐B
+long long zenn_simd_sum(const int a[], size_t length);
+
+// xNg a  b ̓ς߂֐B
+long long zenn_simd_dot_product(const int a[], const int b[], size_t length);
+
+// z a ̒ŏl߂֐B
+// length  0 ̂Ƃ INT_MAX ԂB
+int zenn_simd_min_of(const int a[], size_t length);
+
+// z a ̒ől߂֐B
+// length  0 ̂Ƃ INT_MIN ԂB
+int zenn_simd_max_of(const int a[], size_t length);
+
+// z a ̒ key Ɠŏ̗vf̃CfbNX߂֐B
+// ȂƂ ZENN_SIMD_NOT_FOUND ԂB
+size_t zenn_simd_index_of(const int a[], size_t length, int key);
+
+// z a ̕U߂֐B
+// ŏ̗vf̘̍̓a 64 rbgɎ܂͈͂ŁAa͐mɋ܂B
+double zenn_simd_dispersion(const int a[], size_t length);
+
+// z a  b ̋U߂֐B
+double zenn_simd_covariance(const int a[], const int b[], size_t length);
+
+// z a  b ̑֌W߂֐B
+double zenn_simd_correlation_coefficient(const int a[], const int b[], size_t length);
+
+// s a ̊evf scalar {֐B
+void zenn_simd_scalar_multiplication(int* a, size_t row, size_t column, int scalar);
+
+// s a ̊evf scalar { result ɏފ֐B
+// 傫ȍsł́ALbVȂ悤ɃXg[~OXgAgB
+void zenn_simd_scalar_multiplication_stream(const int* a, int* result, size_t row, size_t column, int scalar);
+
+#ifdef __cplusplus
+}
+
+// C++20 ȍ~ł́Astd::span 󂯎֐gB
+#if __cplusplus >= 202002L || (defined(_MSVC_LANG) && _MSVC_LANG >= 202002L)
+
+#include <span>
+#include <stdexcept>
+
+namespace zenn_simd
+{
+	inline constexpr size_t not_found = ZENN_SIMD_NOT_FOUND;
+
+	// 2 ̔z̗vfقȂꍇ́AĂяǒƂėO𓊂B
+	// Zɍ킹ƁA肪ȂȂAʂ̈ꕔ܂Ȃ܂܂ɂȂB
+	inline void check_same_size(size_t a_size, size_t b_size)
+	{
+		if (a_size != b_size)
+		{
+			throw std::invalid_argument("zenn_simd: the two spans must have the same size");
+		}
+	}
+
+	inline long long sum(std::span<const int> a)
+	{
+		return zenn_simd_sum(a.data(), a.size());
+	}
+
+	// a  b ̗vfقȂꍇ́Astd::invalid_argument 𓊂B
+	inline long long dot_product(std::span<const int> a, std::span<const int> b)
+	{
+		check_same_size(a.size(), b.size());
+		return zenn_simd_dot_product(a.data(), b.data(), a.size());
+	}
+
+	inline int min_of(std::span<const int> a)
+	{
+		return zenn_simd_min_of(a.data(), a.size());
+	}
+
+	inline int max_of(std::span<const int> a)
+	{
+		return zenn_simd_max_of(a.data(), a.size());
+	}
+
+	inline size_t index_of(std::span<const int> a, int key)
+	{
+		return zenn_simd_index_of(a.data(), a.size(), key);
+	}
+
+	inline double dispersion(std::span<const int> a)
+	{
+		return zenn_simd_dispersion(a.data(), a.size());
+	}
+
+	inline double covariance(std::span<const int> a, std::span<const int> b)
+	{
+		check_same_size(a.size(), b.size());
+		return zenn_simd_covariance(a.data(), b.data(), a.size());
+	}
+
+	inline double correlation_coefficient(std::span<const int> a, std::span<const int> b)
+	{
+		check_same_size(a.size(), b.size());
+		return zenn_simd_correlation_coefficient(a.data(), b.data(), a.size());
+	}
+
+	// śAsׂ 1 ̔zƂēnB
+	inline void scalar_multiplication(std::span<int> a, int scalar)
+	{
+		zenn_simd_scalar_multiplication(a.data(), 1, a.size(), scalar);
+	}
+
+	inline void scalar_multiplication(std::span<const int> a, std::span<int> result, int scalar)
+	{
+		check_same_size(a.size(), result.size());
+		zenn_simd_scalar_multiplication_stream(a.data(), result.data(), 1, a.size(), scalar);
+	}
+}
+
+#endif
+
+#endif
+
+#endif
@@ -0,0 +1,15 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include "zenn_simd_internal.h"
+
+long long zenn_simd_horizontal_add_epi64(__m256i sum256)
+{
+	__m128i sum128 = _mm_add_epi64(_mm256_castsi256_si128(sum256), _mm256_extracti128_si256(sum256, 1));
+	sum128 = _mm_add_epi64(sum128, _mm_unpackhi_epi64(sum128, sum128));
+
+	// _mm_cvtsi128_si64  64 rbgłgȂ̂ŁA[oRB
+	long long result[2];
+	_mm_storeu_si128((__m128i*)result, sum128);
+	return result[0];
+}
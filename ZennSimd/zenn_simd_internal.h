@@ -0,0 +1,20 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#ifndef ZENN_SIMD_INTERNAL_H
+#define ZENN_SIMD_INTERNAL_H
+
+#include <intrin.h>
+#include "zenn_simd.h"
+
+// Cu̒Ŏg`B
+
+// ̗vfȏ̔z̓LbVɎ܂ȂƂ݂ȂAXg[~OXgAgB
+#ifndef LARGE_INPUT_THRESHOLD
+#define LARGE_INPUT_THRESHOLD (1 << 20)
+#endif
+
+// 64 rbg 4 ̗vf̘a߂֐B
+long long zenn_simd_horizontal_add_epi64(__m256i sum256);
+
+#endif
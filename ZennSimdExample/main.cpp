@@ -0,0 +1,70 @@
+// MIT License
+// Refer to LICENSE.txt for more information.
+
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+#include <zenn_simd.h>
+
+// ZennSimd Cu̎gTvB
+// C ̊֐ƁAstd::span 󂯎 C++ ̊֐̗gB
+
+int main()
+{
+	std::vector<int> a = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	std::vector<int> b = { 9, 8, 7, 6, 5, 4, 3, 2, 1 };
+
+	// C ̊֐B
+	std::printf("zenn_simd_sum:                      %lld\n", zenn_simd_sum(a.data(), a.size()));
+	std::printf("zenn_simd_dot_product:              %lld\n", zenn_simd_dot_product(a.data(), b.data(), a.size()));
+	std::printf("zenn_simd_index_of:                 %zu\n", zenn_simd_index_of(a.data(), a.size(), 5));
+
+	// C++ ̊֐B
+	std::printf("zenn_simd::min_of:                  %d\n", zenn_simd::min_of(a));
+	std::printf("zenn_simd::max_of:                  %d\n", zenn_simd::max_of(a));
+	std::printf("zenn_simd::dispersion:              %lf\n", zenn_simd::dispersion(a));
+	std::printf("zenn_simd::covariance:              %lf\n", zenn_simd::covariance(a, b));
+	std::printf("zenn_simd::correlation_coefficient: %lf\n", zenn_simd::correlation_coefficient(a, b));
+
+	if (zenn_simd::index_of(a, 10) == zenn_simd::not_found)
+	{
+		std::printf("zenn_simd::index_of:                not found\n");
+	}
+
+	zenn_simd::scalar_multiplication(a, 3);
+	std::printf("zenn_simd::scalar_multiplication:  ");
+
+	for (int value : a)
+	{
+		std::printf(" %d", value);
+	}
+
+	std::printf("\n");
+
+	// int ł͌ӂꂷaA64 rbgŐ܂B
+	std::vector<int> large(1 << 22, 1 << 12);
+	std::printf("\nzenn_simd::sum:                     %lld (expected %lld)\n", zenn_simd::sum(large), (long long)large.size() << 12);
+	std::printf("zenn_simd::dot_product:             %lld (expected %lld)\n", zenn_simd::dot_product(large, large), (long long)large.size() << 24);
+
+	// ςL傫ĂAU͌ȂB
+	std::vector<int> shifted(800);
+
+	for (size_t i = 0; i < shifted.size(); i++)
+	{
+		shifted[i] = 100000000 + (int)(i % 10);
+	}
+
+	std::printf("zenn_simd::dispersion:              %lf (expected 8.25)\n", zenn_simd::dispersion(shifted));
+
+	// vf̈قȂznƁAZɍ킹ɗO𓊂B
+	try
+	{
+		zenn_simd::covariance(a, shifted);
+	}
+	catch (const std::invalid_argument& e)
+	{
+		std::printf("zenn_simd::covariance(a, shifted):  %s\n", e.what());
+	}
+
+	return 0;
+}